@@ -0,0 +1,327 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Benchmarks of the futures machinery, reporting one CSV line per measurement so that the results of two builds can
+// be compared by a script:
+//
+//    benchmark,policy,n,iterations,median_ns,min_ns
+//
+// where n is the parameter of the benchmark (chain depth, number of futures or of threads) and median_ns and min_ns
+// are the median and the minimum over the repetitions of the time per iteration.
+//
+// usage: future_bench [--quick] [--repetitions=<r>] [--filter=<substring of the benchmark name>]
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/csbl/vector.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef boost::chrono::high_resolution_clock Clock;
+
+namespace
+{
+  // the options of the run
+  bool quick = false;
+  int repetitions = 5;
+  const char* filter = 0;
+  bool ok = true;
+
+  // scales the number of iterations down for a quick run, as done by the build target
+  long scaled(long iterations)
+  {
+    return quick ? std::max(iterations / 20, 1L) : iterations;
+  }
+
+  void check(bool condition, const char* name)
+  {
+    if (! condition)
+    {
+      std::cerr << "ERROR= wrong result in " << name << std::endl;
+      ok = false;
+    }
+  }
+
+  /**
+   * Runs <c>bench(iterations)</c> once to warm up and then \c repetitions times, and reports the time per iteration.
+   * \c Bench returns whether its results were right.
+   */
+  template <typename Bench>
+  void measure(const char* name, const char* policy, long n, long iterations, Bench bench)
+  {
+    if (filter && std::strstr(name, filter) == 0)
+      return;
+    iterations = scaled(iterations);
+    check(bench(std::max(iterations / 10, 1L)), name);
+    std::vector<double> samples;
+    for (int r = 0; r < repetitions; ++r)
+    {
+      Clock::time_point t0 = Clock::now();
+      bool right = bench(iterations);
+      Clock::duration d = Clock::now() - t0;
+      check(right, name);
+      samples.push_back(boost::chrono::duration<double, boost::nano>(d).count() / iterations);
+    }
+    std::sort(samples.begin(), samples.end());
+    std::cout << name << ',' << policy << ',' << n << ',' << iterations << ','
+        << samples[samples.size() / 2] << ',' << samples.front() << std::endl;
+  }
+
+  int inc(boost::future<int> f)
+  {
+    return f.get() + 1;
+  }
+
+  int one()
+  {
+    return 1;
+  }
+
+  // a promise set and its future got by the same thread
+  struct round_trip
+  {
+    bool operator()(long iterations) const
+    {
+      long sum = 0;
+      for (long i = 0; i < iterations; ++i)
+      {
+        boost::promise<int> p;
+        boost::future<int> f = p.get_future();
+        p.set_value(1);
+        sum += f.get();
+      }
+      return sum == iterations;
+    }
+  };
+
+  // the thread replying to ping_pong
+  struct pong
+  {
+    boost::promise<int>* pings_;
+    boost::promise<int>* pongs_;
+    long iterations_;
+    pong(boost::promise<int>* pings, boost::promise<int>* pongs, long iterations)
+    : pings_(pings), pongs_(pongs), iterations_(iterations) {}
+    void operator()()
+    {
+      for (long i = 0; i < iterations_; ++i)
+        pongs_[i].set_value(pings_[i].get_future().get() + 1);
+    }
+  };
+
+  // a promise set by a thread and its future got by another one, which replies with another promise
+  struct ping_pong
+  {
+    bool operator()(long iterations) const
+    {
+      boost::csbl::vector<boost::promise<int> > pings(iterations);
+      boost::csbl::vector<boost::promise<int> > pongs(iterations);
+      boost::csbl::vector<boost::future<int> > replies;
+      replies.reserve(iterations);
+      for (long i = 0; i < iterations; ++i)
+        replies.push_back(pongs[i].get_future());
+      boost::thread t((pong(&pings[0], &pongs[0], iterations)));
+      bool right = true;
+      for (long i = 0; i < iterations; ++i)
+      {
+        pings[i].set_value(int(i));
+        right = replies[i].get() == int(i) + 1 && right;
+      }
+      t.join();
+      return right;
+    }
+  };
+
+  struct make_ready
+  {
+    bool operator()(long iterations) const
+    {
+      long sum = 0;
+      for (long i = 0; i < iterations; ++i)
+        sum += boost::make_ready_future(1).get();
+      return sum == iterations;
+    }
+  };
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+  // a chain of continuations attached before the first future is ready
+  template <typename Policy>
+  struct then_chain
+  {
+    Policy& policy_;
+    int depth_;
+    then_chain(Policy& policy, int depth) : policy_(policy), depth_(depth) {}
+    bool operator()(long iterations) const
+    {
+      bool right = true;
+      for (long i = 0; i < iterations; ++i)
+      {
+        boost::promise<int> p;
+        boost::future<int> f = p.get_future();
+        for (int d = 0; d < depth_; ++d)
+          f = f.then(policy_, &inc);
+        p.set_value(0);
+        right = f.get() == depth_ && right;
+      }
+      return right;
+    }
+  };
+
+  template <typename Policy>
+  void then_chains(const char* policy_name, Policy& policy, long iterations)
+  {
+    for (int depth = 1; depth <= 64; depth *= 2)
+      measure("then_chain", policy_name, depth, std::max(iterations / depth, 1L), then_chain<Policy>(policy, depth));
+  }
+#endif
+
+  // wait_for_any over n futures of which only the last one is ready
+  struct wait_for_any_ready
+  {
+    std::size_t n_;
+    explicit wait_for_any_ready(std::size_t n) : n_(n) {}
+    bool operator()(long iterations) const
+    {
+      boost::csbl::vector<boost::promise<int> > ps(n_);
+      boost::csbl::vector<boost::future<int> > fs;
+      fs.reserve(n_);
+      for (std::size_t i = 0; i < n_; ++i)
+        fs.push_back(ps[i].get_future());
+      ps[n_ - 1].set_value(1);
+      bool right = true;
+      for (long i = 0; i < iterations; ++i)
+        right = boost::wait_for_any(fs.begin(), fs.end()) == fs.end() - 1 && right;
+      return right;
+    }
+  };
+
+  // the readers of a shared_future
+  struct reader
+  {
+    boost::shared_future<int> f_;
+    long iterations_;
+    long* sum_;
+    reader(boost::shared_future<int> const& f, long iterations, long* sum) : f_(f), iterations_(iterations), sum_(sum) {}
+    void operator()()
+    {
+      long sum = 0;
+      for (long i = 0; i < iterations_; ++i)
+        sum += f_.get();
+      *sum_ = sum;
+    }
+  };
+
+  // n threads getting the value of the same ready shared_future; the time is per get of each thread
+  struct shared_get
+  {
+    int threads_;
+    explicit shared_get(int threads) : threads_(threads) {}
+    bool operator()(long iterations) const
+    {
+      boost::shared_future<int> f = boost::make_ready_future(1).share();
+      std::vector<long> sums(threads_);
+      boost::thread_group g;
+      for (int t = 0; t < threads_; ++t)
+        g.create_thread(reader(f, iterations, &sums[t]));
+      g.join_all();
+      bool right = true;
+      for (int t = 0; t < threads_; ++t)
+        right = sums[t] == iterations && right;
+      return right;
+    }
+  };
+
+  // a function launched with async and its result got at once
+  struct async_launch
+  {
+    boost::launch policy_;
+    explicit async_launch(boost::launch policy) : policy_(policy) {}
+    bool operator()(long iterations) const
+    {
+      long sum = 0;
+      for (long i = 0; i < iterations; ++i)
+        sum += boost::async(boost::launch(policy_), &one).get();
+      return sum == iterations;
+    }
+  };
+
+  // a function submitted to an executor with async and its result got at once
+  struct async_submit
+  {
+    boost::basic_thread_pool& ex_;
+    explicit async_submit(boost::basic_thread_pool& ex) : ex_(ex) {}
+    bool operator()(long iterations) const
+    {
+      long sum = 0;
+      for (long i = 0; i < iterations; ++i)
+        sum += boost::async(ex_, &one).get();
+      return sum == iterations;
+    }
+  };
+}
+
+int main(int argc, char* argv[])
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if (arg == "--quick")
+      quick = true;
+    else if (arg.compare(0, 14, "--repetitions=") == 0)
+      repetitions = std::max(std::atoi(argv[i] + 14), 1);
+    else if (arg.compare(0, 9, "--filter=") == 0)
+      filter = argv[i] + 9;
+    else
+    {
+      std::cerr << "usage: " << argv[0] << " [--quick] [--repetitions=<r>] [--filter=<benchmark>]" << std::endl;
+      return 2;
+    }
+  }
+
+  boost::launch async = boost::launch::async;
+  boost::launch deferred = boost::launch::deferred;
+  boost::basic_thread_pool ex(2);
+
+  std::cout << "benchmark,policy,n,iterations,median_ns,min_ns" << std::endl;
+  std::cout << std::fixed << std::setprecision(1);
+
+  measure("round_trip", "same_thread", 1, 1000000, round_trip());
+  measure("round_trip", "ping_pong", 1, 100000, ping_pong());
+  measure("make_ready_future", "none", 1, 1000000, make_ready());
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+  boost::launch sync = boost::launch::sync;
+  then_chains("sync", sync, 200000);
+  then_chains("deferred", deferred, 200000);
+  then_chains("executor", ex, 20000);
+  then_chains("async", async, 2000);
+#endif
+
+  for (std::size_t n = 1; n <= 256; n *= 4)
+    measure("wait_for_any", "ready", long(n), std::max(400000L / long(n), 1000L), wait_for_any_ready(n));
+
+  for (int threads = 1; threads <= 8; threads *= 2)
+    measure("shared_future_get", "threads", threads, 1000000, shared_get(threads));
+
+#if ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+  // async(launch::deferred, f) aborts when the rvalue references are emulated
+  measure("async", "deferred", 1, 1000000, async_launch(deferred));
+#endif
+  measure("async", "executor", 1, 100000, async_submit(ex));
+  measure("async", "async", 1, 10000, async_launch(async));
+
+  return ok ? 0 : 1;
+}
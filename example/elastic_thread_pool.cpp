@@ -0,0 +1,148 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Submits closures blocking as on I/O to an elastic_thread_pool, checks that it grows up to its maximum so that they
+// don't starve the others, that it shrinks back to its minimum once idle, and that it can be used by async().
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+#define BOOST_THREAD_QUEUE_DEPRECATE_OLD
+
+#include <boost/thread/executors/elastic_thread_pool.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/atomic.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <iostream>
+
+boost::atomic<bool> io_done(false);
+boost::atomic<int> blocked(0);
+boost::atomic<int> runs(0);
+
+// blocks as on I/O until io_done
+struct blocking_io
+{
+  void operator()() const
+  {
+    ++blocked;
+    while (! io_done) boost::this_thread::sleep_for(boost::chrono::milliseconds(1));
+    --blocked;
+  }
+};
+
+struct count
+{
+  void operator()() const
+  {
+    ++runs;
+  }
+};
+
+int answer()
+{
+  return 42;
+}
+
+template <class Pred>
+bool wait_for(Pred pred)
+{
+  for (int i = 0; i < 500 && ! pred(); ++i)
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(10));
+  return pred();
+}
+
+struct all_blocked
+{
+  bool operator()() const { return blocked == 4; }
+};
+struct all_run
+{
+  bool operator()() const { return runs == 10; }
+};
+struct shrunk
+{
+  boost::elastic_thread_pool* tp_;
+  explicit shrunk(boost::elastic_thread_pool& tp) : tp_(&tp) {}
+  bool operator()() const { return tp_->thread_count() == 1; }
+};
+
+int main()
+{
+  try
+  {
+    {
+      boost::elastic_thread_pool tp(1, 5, boost::chrono::milliseconds(50));
+      if (tp.thread_count() != 1)
+      {
+        std::cout << "ERROR= the pool doesn't start with its minimum" << std::endl;
+        return 1;
+      }
+      // the blocked closures make the pool grow, so that a thread is left to run the others
+      for (int i = 0; i < 4; ++i) tp.submit(blocking_io());
+      if (! wait_for(all_blocked()))
+      {
+        std::cout << "ERROR= the pool didn't grow with the blocked closures" << std::endl;
+        return 1;
+      }
+      for (int i = 0; i < 10; ++i) tp.submit(count());
+      if (! wait_for(all_run()))
+      {
+        std::cout << "ERROR= closures starved by the blocked ones" << std::endl;
+        return 1;
+      }
+      if (tp.thread_count() > 5)
+      {
+        std::cout << "ERROR= the pool grew beyond its maximum" << std::endl;
+        return 1;
+      }
+      // once idle for the keep-alive period, the pool shrinks back to its minimum
+      io_done = true;
+      if (! wait_for(shrunk(tp)))
+      {
+        std::cout << "ERROR= the pool didn't shrink, " << tp.thread_count() << " threads" << std::endl;
+        return 1;
+      }
+      // and grows again
+      runs = 0;
+      for (int i = 0; i < 10; ++i) tp.submit(count());
+      if (! wait_for(all_run()))
+      {
+        std::cout << "ERROR= closures not run after shrinking" << std::endl;
+        return 1;
+      }
+    }
+    {
+      // with no minimum the first closure starts a thread, and the pool models the Executor concept
+      boost::elastic_thread_pool tp(0, 2, boost::chrono::milliseconds(10));
+      boost::future<int> f = boost::async(tp, &answer);
+      if (f.get() != 42)
+      {
+        std::cout << "ERROR= async on an elastic_thread_pool" << std::endl;
+        return 1;
+      }
+      tp.close();
+      try
+      {
+        tp.submit(count());
+        std::cout << "ERROR= closure submitted on a closed pool" << std::endl;
+        return 1;
+      }
+      catch (boost::sync_queue_is_closed&)
+      {
+      }
+    }
+  }
+  catch (std::exception& ex)
+  {
+    std::cout << "ERROR= " << ex.what() << "" << std::endl;
+    return 1;
+  }
+  catch (...)
+  {
+    std::cout << " ERROR= exception thrown" << std::endl;
+    return 2;
+  }
+  return 0;
+}
@@ -0,0 +1,207 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Instruments a basic_thread_pool, a loop_executor and a serial_executor, checks the counters and histograms of the
+// closures run through them, and measures the cost of submitting through an enabled and a disabled adaptor.
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+#define BOOST_THREAD_QUEUE_DEPRECATE_OLD
+
+#include <boost/thread/executors/instrumented_executor.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/executors/loop_executor.hpp>
+#include <boost/thread/executors/serial_executor.hpp>
+#include <boost/thread/executors/executor_adaptor.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/atomic.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <iostream>
+#include <stdexcept>
+
+typedef boost::chrono::steady_clock Clock;
+
+boost::atomic<int> runs(0);
+
+struct sleeper
+{
+  void operator()() const
+  {
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(2));
+    ++runs;
+  }
+};
+
+struct count
+{
+  void operator()() const
+  {
+    ++runs;
+  }
+};
+
+struct thrower
+{
+  void operator()() const
+  {
+    ++runs;
+    throw std::runtime_error("failed");
+  }
+};
+
+template <class Executor>
+bool wait_for_completed(boost::instrumented_executor<Executor>& ie, boost::uint64_t n)
+{
+  for (int i = 0; i < 500 && ie.stats().completed < n; ++i)
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(10));
+  return ie.stats().completed == n;
+}
+
+bool check_histogram()
+{
+  // each value is within the bounds of its bucket, and the buckets are contiguous
+  boost::uint64_t values[] = { 0, 1, 7, 8, 9, 15, 16, 1000, 123456789, ~boost::uint64_t(0) };
+  for (unsigned i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+  {
+    unsigned b = boost::executor_histogram::bucket_of(values[i]);
+    if (b >= boost::executor_histogram::buckets
+        || values[i] < boost::executor_histogram::bucket_lower(b)
+        || values[i] > boost::executor_histogram::bucket_upper(b))
+      return false;
+  }
+  for (unsigned b = 1; b < boost::executor_histogram::buckets; ++b)
+  {
+    if (boost::executor_histogram::bucket_lower(b) != boost::executor_histogram::bucket_upper(b - 1) + 1)
+      return false;
+  }
+  return true;
+}
+
+int main()
+{
+  try
+  {
+    if (! check_histogram())
+    {
+      std::cout << "ERROR= histogram buckets" << std::endl;
+      return 1;
+    }
+    {
+      boost::basic_thread_pool tp(2);
+      boost::instrumented_executor<boost::basic_thread_pool> ie(tp);
+      for (int i = 0; i < 10; ++i) ie.submit(sleeper());
+      ie.submit(thrower());
+      if (! wait_for_completed(ie, 11))
+      {
+        std::cout << "ERROR= closures not recorded" << std::endl;
+        return 1;
+      }
+      boost::executor_stats st = ie.stats();
+      if (st.submitted != 11 || st.started != 11 || st.failed != 1 || st.queued() != 0 || st.running() != 0
+          || st.run_time.count() != 11 || st.wait_time.count() != 11
+          || st.run_time.percentile(50) < 2000000 || st.busy_time < boost::chrono::milliseconds(20))
+      {
+        std::cout << "ERROR= wrong basic_thread_pool stats" << std::endl;
+        return 1;
+      }
+      std::cout << "basic_thread_pool: run p50 " << st.run_time.percentile(50) << " ns, wait p99 "
+          << st.wait_time.percentile(99) << " ns, utilization " << st.utilization(2) << std::endl;
+
+      // the disabled adaptor submits the closures as is
+      ie.enable(false);
+      ie.submit(count());
+      tp.wait_idle();
+      if (ie.stats().submitted != 11)
+      {
+        std::cout << "ERROR= closure recorded while disabled" << std::endl;
+        return 1;
+      }
+      ie.enable(true);
+
+      // the closures refused by the underlying executor are counted as rejected
+      tp.close();
+      try
+      {
+        ie.submit(count());
+        std::cout << "ERROR= closure submitted on a closed pool" << std::endl;
+        return 1;
+      }
+      catch (boost::sync_queue_is_closed&)
+      {
+      }
+      st = ie.stats();
+      if (st.rejected != 1 || st.submitted != 11)
+      {
+        std::cout << "ERROR= rejected closure not counted" << std::endl;
+        return 1;
+      }
+    }
+    {
+      // the wait time of the closures queued on a loop_executor includes the time until the loop runs them
+      boost::loop_executor ex;
+      boost::instrumented_executor<boost::loop_executor> ie(ex);
+      for (int i = 0; i < 5; ++i) ie.submit(count());
+      boost::this_thread::sleep_for(boost::chrono::milliseconds(5));
+      if (ie.stats().queued() != 5)
+      {
+        std::cout << "ERROR= queued closures not counted" << std::endl;
+        return 1;
+      }
+      ex.run_queued_closures();
+      boost::executor_stats st = ie.stats();
+      if (st.completed != 5 || st.wait_time.percentile(0) < 5000000)
+      {
+        std::cout << "ERROR= wrong loop_executor stats" << std::endl;
+        return 1;
+      }
+    }
+    {
+      boost::executor_adaptor<boost::basic_thread_pool> ea(2);
+      boost::serial_executor ser(ea);
+      boost::instrumented_executor<boost::serial_executor> ie(ser);
+      for (int i = 0; i < 10; ++i) ie.submit(sleeper());
+      if (! wait_for_completed(ie, 10))
+      {
+        std::cout << "ERROR= serial closures not recorded" << std::endl;
+        return 1;
+      }
+      // the serial closures wait for the ones submitted before them
+      boost::executor_stats st = ie.stats();
+      if (st.wait_time.percentile(100) < 2000000 * 8)
+      {
+        std::cout << "ERROR= wrong serial_executor stats" << std::endl;
+        return 1;
+      }
+    }
+    {
+      // cost of the instrumentation
+      const int n = 100000;
+      boost::loop_executor ex;
+      boost::instrumented_executor<boost::loop_executor> ie(ex);
+      for (int enabled = 0; enabled < 2; ++enabled)
+      {
+        ie.enable(enabled != 0);
+        Clock::time_point t0 = Clock::now();
+        for (int i = 0; i < n; ++i) ie.submit(count());
+        ex.run_queued_closures();
+        Clock::duration d = Clock::now() - t0;
+        std::cout << (enabled ? "enabled: " : "disabled: ")
+            << boost::chrono::duration<double, boost::nano>(d).count() / n << " ns per closure" << std::endl;
+      }
+    }
+  }
+  catch (std::exception& ex)
+  {
+    std::cout << "ERROR= " << ex.what() << "" << std::endl;
+    return 1;
+  }
+  catch (...)
+  {
+    std::cout << " ERROR= exception thrown" << std::endl;
+    return 2;
+  }
+  return 0;
+}
@@ -0,0 +1,116 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Submits closures to a numa_thread_pool from the main thread, from its workers and on each node, checks that they
+// are all run, reports how many were taken by a worker of another node, and checks that the pool can be used by
+// async().
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+#define BOOST_THREAD_QUEUE_DEPRECATE_OLD
+
+#include <boost/thread/executors/numa_thread_pool.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/atomic.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <iostream>
+
+boost::atomic<long> runs(0);
+boost::atomic<long> remote_runs(0);
+
+struct on_node
+{
+  unsigned node_;
+  explicit on_node(unsigned node) : node_(node) {}
+  void operator()() const
+  {
+    if (boost::this_thread::get_numa_node() != node_) ++remote_runs;
+    ++runs;
+  }
+};
+
+struct spawn
+{
+  boost::numa_thread_pool* tp_;
+  int children_;
+  spawn(boost::numa_thread_pool& tp, int children) : tp_(&tp), children_(children) {}
+  void operator()() const
+  {
+    for (int i = 0; i < children_; ++i) tp_->submit(on_node(boost::this_thread::get_numa_node()));
+    ++runs;
+  }
+};
+
+int answer()
+{
+  return 42;
+}
+
+bool wait_for_runs(long n)
+{
+  for (int i = 0; i < 500 && runs < n; ++i)
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(10));
+  return runs == n;
+}
+
+int main()
+{
+  try
+  {
+    {
+      boost::numa_thread_pool tp(2 * boost::thread::numa_node_count());
+      if (tp.nodes() != boost::thread::numa_node_count())
+      {
+        std::cout << "ERROR= a queue per node expected" << std::endl;
+        return 1;
+      }
+      // closures placed on each node, and closures submitted by the workers, that stay on their node
+      for (unsigned node = 0; node < tp.nodes(); ++node)
+        for (int i = 0; i < 100; ++i)
+          tp.submit_on_node(node, on_node(node));
+      for (int i = 0; i < 10; ++i)
+        tp.submit(spawn(tp, 10));
+      long const expected = 100 * tp.nodes() + 10 + 10 * 10;
+      if (! wait_for_runs(expected))
+      {
+        std::cout << "ERROR= " << runs << " closures run instead of " << expected << std::endl;
+        return 1;
+      }
+      std::cout << remote_runs << " closures run on a remote node" << std::endl;
+    }
+    {
+      // the pool models the Executor concept
+      boost::numa_thread_pool tp;
+      boost::future<int> f = boost::async(tp, &answer);
+      if (f.get() != 42)
+      {
+        std::cout << "ERROR= async on a numa_thread_pool" << std::endl;
+        return 1;
+      }
+      tp.close();
+      try
+      {
+        tp.submit(on_node(0));
+        std::cout << "ERROR= closure submitted on a closed pool" << std::endl;
+        return 1;
+      }
+      catch (boost::sync_queue_is_closed&)
+      {
+      }
+    }
+  }
+  catch (std::exception& ex)
+  {
+    std::cout << "ERROR= " << ex.what() << "" << std::endl;
+    return 1;
+  }
+  catch (...)
+  {
+    std::cout << " ERROR= exception thrown" << std::endl;
+    return 2;
+  }
+  return 0;
+}
@@ -0,0 +1,139 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Measures the throughput of a producer/consumer pipeline built on sync_bounded_queue, lock_free_bounded_queue and
+// spsc_queue, pushing and pulling the elements one by one or by batches.
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_QUEUE_DEPRECATE_OLD
+
+#include <boost/thread/sync_bounded_queue.hpp>
+#include <boost/thread/lock_free_bounded_queue.hpp>
+#include <boost/thread/spsc_queue.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <iostream>
+
+typedef boost::chrono::high_resolution_clock Clock;
+
+const int batch_size = 32;
+
+template <typename Queue>
+struct producer
+{
+  Queue* q_;
+  int n_;
+  producer(Queue* q, int n) : q_(q), n_(n) {}
+  void operator()()
+  {
+    for (int i = 0; i < n_; ++i)
+      q_->push_back(i);
+  }
+};
+
+template <typename Queue>
+struct consumer
+{
+  Queue* q_;
+  long* sum_;
+  consumer(Queue* q, long* sum) : q_(q), sum_(sum) {}
+  void operator()()
+  {
+    int i;
+    while (q_->wait_pull_front(i) == boost::queue_op_status::success)
+      *sum_ += i;
+  }
+};
+
+template <typename Queue>
+struct batch_producer
+{
+  Queue* q_;
+  int n_;
+  batch_producer(Queue* q, int n) : q_(q), n_(n) {}
+  void operator()()
+  {
+    int v[batch_size];
+    for (int i = 0; i < n_; i += batch_size)
+    {
+      int k = 0;
+      for (; k < batch_size && i + k < n_; ++k) v[k] = i + k;
+      q_->push_back(v, v + k);
+    }
+  }
+};
+
+template <typename Queue>
+struct batch_consumer
+{
+  Queue* q_;
+  long* sum_;
+  batch_consumer(Queue* q, long* sum) : q_(q), sum_(sum) {}
+  void operator()()
+  {
+    int v[batch_size];
+    std::size_t n;
+    while (q_->wait_pull_front_n(v, batch_size, n) == boost::queue_op_status::success)
+      for (std::size_t k = 0; k < n; ++k) *sum_ += v[k];
+  }
+};
+
+template <typename Queue, typename Producer, typename Consumer>
+bool bench(const char* title, int producers, int consumers, int n)
+{
+  Queue q(64);
+  long sums[16] = {};
+  Clock::time_point t0 = Clock::now();
+  boost::thread_group cs;
+  for (int i = 0; i < consumers; ++i)
+    cs.create_thread(Consumer(&q, &sums[i]));
+  boost::thread_group ps;
+  for (int i = 0; i < producers; ++i)
+    ps.create_thread(Producer(&q, n));
+  ps.join_all();
+  q.close();
+  cs.join_all();
+  Clock::duration d = Clock::now() - t0;
+
+  long sum = 0;
+  for (int i = 0; i < consumers; ++i)
+    sum += sums[i];
+  std::cout << title << " " << producers << "x" << consumers << ": "
+      << boost::chrono::duration<double, boost::nano>(d).count() / (long(n) * producers) << " ns per element" << std::endl;
+  return sum == long(producers) * n * (n - 1) / 2;
+}
+
+template <typename Queue>
+bool bench(const char* title, int producers, int consumers, int n)
+{
+  return bench<Queue, producer<Queue>, consumer<Queue> >(title, producers, consumers, n);
+}
+
+template <typename Queue>
+bool bench_batch(const char* title, int producers, int consumers, int n)
+{
+  return bench<Queue, batch_producer<Queue>, batch_consumer<Queue> >(title, producers, consumers, n);
+}
+
+int main()
+{
+  const int n = 200000;
+  bool ok = true;
+  ok = bench<boost::sync_bounded_queue<int> >("sync_bounded_queue", 1, 1, n) && ok;
+  ok = bench<boost::lock_free_bounded_queue<int> >("lock_free_bounded_queue", 1, 1, n) && ok;
+  ok = bench<boost::spsc_queue<int> >("spsc_queue", 1, 1, n) && ok;
+  ok = bench<boost::sync_bounded_queue<int> >("sync_bounded_queue", 4, 4, n) && ok;
+  ok = bench<boost::lock_free_bounded_queue<int> >("lock_free_bounded_queue", 4, 4, n) && ok;
+  ok = bench_batch<boost::sync_bounded_queue<int> >("sync_bounded_queue batch", 1, 1, n) && ok;
+  ok = bench_batch<boost::sync_bounded_queue<int> >("sync_bounded_queue batch", 4, 4, n) && ok;
+  ok = bench_batch<boost::spsc_queue<int> >("spsc_queue batch", 1, 1, n) && ok;
+  if (! ok)
+  {
+    std::cout << "ERROR= wrong sum" << std::endl;
+    return 1;
+  }
+  return 0;
+}
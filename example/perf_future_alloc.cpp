@@ -0,0 +1,80 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Measures the cost of creating, fulfilling and consuming a promise/future pair, depending on how the shared state
+// is allocated.
+// perf_future_alloc_caching.cpp runs the same measures with BOOST_THREAD_FUTURE_USES_CACHING_ALLOCATOR.
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/caching_allocator.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <iostream>
+#include <memory>
+
+typedef boost::chrono::high_resolution_clock Clock;
+
+#if defined BOOST_THREAD_FUTURE_USES_CACHING_ALLOCATOR
+const char* const mode = "caching shared states";
+#else
+const char* const mode = "new shared states";
+#endif
+
+const int n = 1000000;
+
+struct default_promise
+{
+  static boost::promise<int> make()
+  {
+    return boost::promise<int>();
+  }
+};
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CTOR_ALLOCATORS
+template <typename Allocator>
+struct allocator_promise
+{
+  static boost::promise<int> make()
+  {
+    return boost::promise<int>(boost::allocator_arg, Allocator());
+  }
+};
+#endif
+
+template <typename Factory>
+long bench(const char* title)
+{
+  long sum = 0;
+  Clock::time_point t0 = Clock::now();
+  for (int i = 0; i < n; ++i)
+  {
+    boost::promise<int> p = Factory::make();
+    boost::future<int> f = p.get_future();
+    p.set_value(i);
+    sum += f.get();
+  }
+  Clock::duration d = Clock::now() - t0;
+  std::cout << mode << ": " << title << " " << boost::chrono::duration<double, boost::nano>(d).count() / n
+      << " ns per promise" << std::endl;
+  return sum;
+}
+
+int main()
+{
+  long expected = long(n) * (n - 1) / 2;
+  bool ok = bench<default_promise>("promise()") == expected;
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CTOR_ALLOCATORS
+  ok = bench<allocator_promise<std::allocator<int> > >("promise(allocator_arg, std::allocator)") == expected && ok;
+  ok = bench<allocator_promise<boost::caching_allocator<int> > >("promise(allocator_arg, caching_allocator)") == expected && ok;
+#endif
+  if (! ok)
+  {
+    std::cout << "ERROR= wrong sum" << std::endl;
+    return 1;
+  }
+  return 0;
+}
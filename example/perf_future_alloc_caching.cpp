@@ -0,0 +1,8 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_THREAD_FUTURE_USES_CACHING_ALLOCATOR
+
+#include "perf_future_alloc.cpp"
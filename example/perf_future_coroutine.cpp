@@ -0,0 +1,69 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Keeps many tasks waiting on futures at the same time on a thread pool of two threads: a suspended task holds no
+// thread, so the number of tasks in flight is not bounded by the number of threads.
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/future_coroutine.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <iostream>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_COROUTINES
+
+typedef boost::chrono::high_resolution_clock Clock;
+
+const std::size_t in_flight = 10000;
+const int steps = 4;
+
+boost::task<long> chain(boost::csbl::vector<boost::shared_future<int> > const& steps_ready)
+{
+  long sum = 0;
+  for (std::size_t i = 0; i < steps_ready.size(); ++i)
+    sum += co_await steps_ready[i];
+  co_return sum;
+}
+
+int main()
+{
+  boost::basic_thread_pool pool(2);
+  boost::csbl::vector<boost::promise<int> > ps(steps);
+  boost::csbl::vector<boost::shared_future<int> > steps_ready;
+  for (int i = 0; i < steps; ++i)
+    steps_ready.push_back(ps[i].get_future().share());
+
+  Clock::time_point t0 = Clock::now();
+  boost::csbl::vector<boost::future<long> > results;
+  results.reserve(in_flight);
+  for (std::size_t i = 0; i < in_flight; ++i)
+    results.push_back(boost::spawn(pool, chain(steps_ready)));
+  for (int i = 0; i < steps; ++i)
+    ps[i].set_value(1);
+  long sum = 0;
+  for (std::size_t i = 0; i < in_flight; ++i)
+    sum += results[i].get();
+  Clock::duration d = Clock::now() - t0;
+
+  std::cout << in_flight << " tasks of " << steps << " awaits on 2 threads: "
+      << boost::chrono::duration<double, boost::micro>(d).count() / in_flight << " us per task" << std::endl;
+  if (sum != long(in_flight) * steps)
+  {
+    std::cout << "ERROR= wrong sum" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
@@ -0,0 +1,95 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Measures the cost of querying a ready future: is_ready(), wait() and get() on a shared_future, from one thread and
+// from several threads sharing the same state.
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <iostream>
+
+typedef boost::chrono::high_resolution_clock Clock;
+
+const int n = 2000000;
+
+struct get_loop
+{
+  boost::shared_future<int> f_;
+  long* sum_;
+  get_loop(boost::shared_future<int> f, long* sum) : f_(f), sum_(sum) {}
+  void operator()()
+  {
+    long s = 0;
+    for (int i = 0; i < n; ++i)
+      s += f_.get();
+    *sum_ = s;
+  }
+};
+
+struct is_ready_loop
+{
+  boost::shared_future<int> f_;
+  long* sum_;
+  is_ready_loop(boost::shared_future<int> f, long* sum) : f_(f), sum_(sum) {}
+  void operator()()
+  {
+    long s = 0;
+    for (int i = 0; i < n; ++i)
+      s += f_.is_ready();
+    *sum_ = s;
+  }
+};
+
+struct wait_loop
+{
+  boost::shared_future<int> f_;
+  long* sum_;
+  wait_loop(boost::shared_future<int> f, long* sum) : f_(f), sum_(sum) {}
+  void operator()()
+  {
+    for (int i = 0; i < n; ++i)
+      f_.wait();
+    *sum_ = n;
+  }
+};
+
+template <typename Loop>
+bool bench(const char* title, int threads)
+{
+  boost::shared_future<int> f = boost::make_ready_future(1).share();
+  long sums[16] = {};
+  Clock::time_point t0 = Clock::now();
+  boost::thread_group g;
+  for (int i = 0; i < threads; ++i)
+    g.create_thread(Loop(f, &sums[i]));
+  g.join_all();
+  Clock::duration d = Clock::now() - t0;
+  std::cout << title << " x" << threads << ": " << boost::chrono::duration<double, boost::nano>(d).count() / n
+      << " ns per call" << std::endl;
+  bool ok = true;
+  for (int i = 0; i < threads; ++i)
+    ok = ok && sums[i] == n;
+  return ok;
+}
+
+int main()
+{
+  bool ok = true;
+  ok = bench<get_loop>("shared_future::get()", 1) && ok;
+  ok = bench<is_ready_loop>("shared_future::is_ready()", 1) && ok;
+  ok = bench<wait_loop>("shared_future::wait()", 1) && ok;
+  ok = bench<get_loop>("shared_future::get()", 4) && ok;
+  ok = bench<is_ready_loop>("shared_future::is_ready()", 4) && ok;
+  if (! ok)
+  {
+    std::cout << "ERROR= wrong sum" << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,82 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Measures the latency of async(launch::async, f) and of a chain of .then(launch::async, f) continuations.
+// perf_future_then_default_executor.cpp runs the same measures with BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR.
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/future.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <iostream>
+
+typedef boost::chrono::high_resolution_clock Clock;
+
+#if defined BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR
+const char* const mode = "default executor";
+#else
+const char* const mode = "thread per task";
+#endif
+
+int zero()
+{
+  return 0;
+}
+
+int inc(boost::future<int> f)
+{
+  return f.get() + 1;
+}
+
+int main()
+{
+  const int tasks = 2000;
+  const int links = 100;
+  const int chains = 20;
+  try
+  {
+    Clock::time_point t0 = Clock::now();
+    int sum = 0;
+    for (int i = 0; i < tasks; ++i)
+    {
+      boost::future<int> f = boost::async(boost::launch::async, &zero);
+      sum += f.get();
+    }
+    Clock::duration d = Clock::now() - t0;
+    std::cout << mode << ": async().get() " << boost::chrono::duration<double, boost::micro>(d).count() / tasks
+        << " us per task" << std::endl;
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+    t0 = Clock::now();
+    for (int c = 0; c < chains; ++c)
+    {
+      boost::future<int> f = boost::async(boost::launch::async, &zero);
+      for (int i = 0; i < links; ++i)
+        f = f.then(boost::launch::async, &inc);
+      sum += f.get();
+    }
+    d = Clock::now() - t0;
+    std::cout << mode << ": then() chain " << boost::chrono::duration<double, boost::micro>(d).count() / (chains * links)
+        << " us per continuation" << std::endl;
+    if (sum != chains * links)
+    {
+      std::cout << "ERROR= " << sum << " instead of " << chains * links << std::endl;
+      return 1;
+    }
+#endif
+  }
+  catch (std::exception& ex)
+  {
+    std::cout << "ERROR= " << ex.what() << "" << std::endl;
+    return 1;
+  }
+  catch (...)
+  {
+    std::cout << " ERROR= exception thrown" << std::endl;
+    return 2;
+  }
+  return 0;
+}
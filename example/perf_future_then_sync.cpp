@@ -0,0 +1,68 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Measures the cost of a 5-stage pipeline of fine-grained continuations attached before the first stage is ready,
+// with .then(launch::sync, f), run in the completing thread, and with .then(launch::async, f).
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/future.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <iostream>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+
+typedef boost::chrono::high_resolution_clock Clock;
+
+const int stages = 5;
+
+int inc(boost::future<int> f)
+{
+  return f.get() + 1;
+}
+
+int pipeline(boost::launch policy)
+{
+  boost::promise<int> p;
+  boost::future<int> f = p.get_future();
+  for (int i = 0; i < stages; ++i)
+    f = f.then(policy, &inc);
+  p.set_value(0);
+  return f.get();
+}
+
+bool bench(const char* title, boost::launch policy, int rounds)
+{
+  bool ok = true;
+  Clock::time_point t0 = Clock::now();
+  for (int i = 0; i < rounds; ++i)
+    ok = pipeline(policy) == stages && ok;
+  Clock::duration d = Clock::now() - t0;
+  std::cout << title << ": " << boost::chrono::duration<double, boost::micro>(d).count() / rounds
+      << " us per " << stages << "-stage pipeline" << std::endl;
+  return ok;
+}
+
+int main()
+{
+  bool ok = true;
+  ok = bench("then(launch::sync)", boost::launch::sync, 100000) && ok;
+  ok = bench("then(launch::async)", boost::launch::async, 1000) && ok;
+  if (! ok)
+  {
+    std::cout << "ERROR= wrong result" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
@@ -0,0 +1,104 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Measures the time spent by the thread fulfilling a batch of responses whose futures have a continuation run on a
+// thread pool, as an RPC demultiplexer does, with a promise::set_value() and a submission per response, and with a
+// promise_batch committed to the pool, which submits a single closure per batch.
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/promise_batch.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <iostream>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+
+typedef boost::chrono::high_resolution_clock Clock;
+
+const int responses = 256;
+
+int handle(boost::future<int> f)
+{
+  return f.get() + 1;
+}
+
+bool check(boost::future<int>* f)
+{
+  bool ok = true;
+  for (int i = 0; i < responses; ++i)
+    ok = f[i].get() == i + 1 && ok;
+  return ok;
+}
+
+bool one_by_one(boost::basic_thread_pool& ex, Clock::duration& d)
+{
+  boost::promise<int> p[responses];
+  boost::future<int> f[responses];
+  for (int i = 0; i < responses; ++i)
+    f[i] = p[i].get_future().then(ex, &handle);
+  Clock::time_point t0 = Clock::now();
+  for (int i = 0; i < responses; ++i)
+    p[i].set_value(i);
+  d += Clock::now() - t0;
+  return check(f);
+}
+
+bool batched(boost::basic_thread_pool& ex, boost::promise_batch<int>& b, Clock::duration& d)
+{
+  boost::promise<int> p[responses];
+  boost::future<int> f[responses];
+  for (int i = 0; i < responses; ++i)
+    f[i] = p[i].get_future().then(boost::launch::sync, &handle);
+  Clock::time_point t0 = Clock::now();
+  for (int i = 0; i < responses; ++i)
+    b.set_value(p[i], i);
+  b.commit(ex);
+  d += Clock::now() - t0;
+  return check(f);
+}
+
+void report(const char* title, Clock::duration d, int rounds)
+{
+  std::cout << title << ": " << boost::chrono::duration<double, boost::micro>(d).count() / rounds
+      << " us per batch of " << responses << " responses" << std::endl;
+}
+
+int main()
+{
+  const int rounds = 1000;
+  bool ok = true;
+  boost::basic_thread_pool ex(2);
+  {
+    Clock::duration d = Clock::duration::zero();
+    for (int i = 0; i < rounds; ++i)
+      ok = one_by_one(ex, d) && ok;
+    report("promise::set_value", d, rounds);
+  }
+  {
+    boost::promise_batch<int> b;
+    b.reserve(responses);
+    Clock::duration d = Clock::duration::zero();
+    for (int i = 0; i < rounds; ++i)
+      ok = batched(ex, b, d) && ok;
+    report("promise_batch::commit(ex)", d, rounds);
+  }
+  if (! ok)
+  {
+    std::cout << "ERROR= wrong result" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
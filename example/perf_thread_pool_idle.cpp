@@ -0,0 +1,117 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Compares the idle CPU consumption and the submit-to-start latency of a basic_thread_pool
+// whose workers spin then park (the default) with one whose workers yield-spin forever
+// on schedule_one_or_yield().
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_QUEUE_DEPRECATE_OLD
+#define BOOST_THREAD_USES_CHRONO
+
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/thread/thread_only.hpp>
+#include <boost/thread/detail/thread_group.hpp>
+#include <boost/bind.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/chrono/process_cpu_clocks.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+typedef boost::chrono::high_resolution_clock Clock;
+
+struct stamp
+{
+  boost::promise<Clock::time_point>* p_;
+  explicit stamp(boost::promise<Clock::time_point>* p) : p_(p) {}
+  typedef void result_type;
+  void operator()()
+  {
+    p_->set_value(Clock::now());
+  }
+};
+
+void yield_spin(boost::basic_thread_pool* tp)
+{
+  while (!tp->closed())
+  {
+    tp->schedule_one_or_yield();
+  }
+  while (tp->try_executing_one())
+  {
+  }
+}
+
+/// CPU time (user + system) consumed by the process per wall-clock second while the pool is idle.
+double idle_cpu(boost::chrono::milliseconds period)
+{
+  typedef boost::chrono::process_user_cpu_clock UserClock;
+  typedef boost::chrono::process_system_cpu_clock SystemClock;
+  UserClock::time_point u0 = UserClock::now();
+  SystemClock::time_point s0 = SystemClock::now();
+  boost::this_thread::sleep_for(period);
+  boost::chrono::nanoseconds used = (UserClock::now() - u0) + (SystemClock::now() - s0);
+  return double(used.count()) / boost::chrono::nanoseconds(period).count();
+}
+
+/// Submit-to-start latencies in microseconds. When \c pause is not zero each submission is
+/// preceded by a sleep so that the workers find the queue empty.
+std::vector<double> latencies(boost::basic_thread_pool& tp, unsigned n, boost::chrono::microseconds pause)
+{
+  std::vector<double> res;
+  res.reserve(n);
+  for (unsigned i = 0; i < n; ++i)
+  {
+    if (pause.count()) boost::this_thread::sleep_for(pause);
+    boost::promise<Clock::time_point> p;
+    boost::future<Clock::time_point> f = p.get_future();
+    Clock::time_point t0 = Clock::now();
+    tp.submit(stamp(&p));
+    Clock::time_point t1 = f.get();
+    res.push_back(boost::chrono::duration<double, boost::micro>(t1 - t0).count());
+  }
+  std::sort(res.begin(), res.end());
+  return res;
+}
+
+void report(const char* title, boost::basic_thread_pool& tp, unsigned thread_count)
+{
+  // let the workers go idle first
+  boost::this_thread::sleep_for(boost::chrono::milliseconds(100));
+  double cpu = idle_cpu(boost::chrono::milliseconds(1000));
+  std::vector<double> cold = latencies(tp, 200, boost::chrono::microseconds(1000));
+  std::vector<double> hot = latencies(tp, 2000, boost::chrono::microseconds(0));
+
+  std::cout << title << " (" << thread_count << " threads)" << std::endl;
+  std::cout << "  idle cpu                 : " << cpu << " cores" << std::endl;
+  std::cout << "  cold latency median/max  : " << cold[cold.size() / 2] << " / " << cold.back() << " us" << std::endl;
+  std::cout << "  hot latency median/max   : " << hot[hot.size() / 2] << " / " << hot.back() << " us" << std::endl;
+}
+
+int main()
+{
+  unsigned const thread_count = boost::thread::hardware_concurrency();
+  std::cout << "BOOST_THREAD_POOL_SPIN_COUNT = " << BOOST_THREAD_POOL_SPIN_COUNT << std::endl;
+  {
+    boost::basic_thread_pool tp(thread_count);
+    report("spin then park", tp, thread_count);
+  }
+  {
+    // a pool without worker threads, driven by threads that never park
+    boost::basic_thread_pool tp(0);
+    boost::thread_group drivers;
+    for (unsigned i = 0; i < thread_count; ++i)
+    {
+      drivers.create_thread(boost::bind(yield_spin, &tp));
+    }
+    report("yield spin", tp, thread_count);
+    tp.close();
+    drivers.join_all();
+  }
+  return 0;
+}
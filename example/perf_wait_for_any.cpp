@@ -0,0 +1,60 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Measures wait_for_any over many futures: the futures are satisfied one after the other by another thread and each
+// of them is waited for with wait_for_any over the remaining ones.
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/csbl/vector.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <iostream>
+
+
+typedef boost::chrono::high_resolution_clock Clock;
+
+const std::size_t count = 256;
+
+struct satisfy
+{
+  boost::promise<int>* ps_;
+  explicit satisfy(boost::promise<int>* ps) : ps_(ps) {}
+  void operator()()
+  {
+    for (std::size_t i = count; i > 0; --i)
+      ps_[i - 1].set_value(int(i - 1));
+  }
+};
+
+int main()
+{
+  boost::promise<int> ps[count];
+  boost::csbl::vector<boost::future<int> > fs;
+  for (std::size_t i = 0; i < count; ++i)
+    fs.push_back(ps[i].get_future());
+
+  Clock::time_point t0 = Clock::now();
+  boost::thread producer((satisfy(ps)));
+  long sum = 0;
+  while (! fs.empty())
+  {
+    boost::csbl::vector<boost::future<int> >::iterator it = boost::wait_for_any(fs.begin(), fs.end());
+    sum += it->get();
+    fs.erase(it);
+  }
+  producer.join();
+  Clock::duration d = Clock::now() - t0;
+  std::cout << "wait_for_any over up to " << count << " futures: "
+      << boost::chrono::duration<double, boost::micro>(d).count() / count << " us per call" << std::endl;
+  if (sum != long(count * (count - 1) / 2))
+  {
+    std::cout << "ERROR= wrong sum" << std::endl;
+    return 1;
+  }
+  return 0;
+}
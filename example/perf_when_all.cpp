@@ -0,0 +1,75 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Measures the cost of gathering many futures with when_all and when_any: each round fans out to many promises,
+// combines their futures and then satisfies the promises.
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/future.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <iostream>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY
+
+typedef boost::chrono::high_resolution_clock Clock;
+
+const std::size_t fan_out = 128;
+const int rounds = 2000;
+
+enum gather { gather_when_all, gather_when_any };
+
+long round(gather how)
+{
+  boost::csbl::vector<boost::promise<int> > ps(fan_out);
+  boost::csbl::vector<boost::future<int> > fs;
+  fs.reserve(fan_out);
+  for (std::size_t i = 0; i < fan_out; ++i)
+    fs.push_back(ps[i].get_future());
+  boost::future<boost::csbl::vector<boost::future<int> > > all = how == gather_when_all
+      ? boost::when_all(fs.begin(), fs.end())
+      : boost::when_any(fs.begin(), fs.end());
+  for (std::size_t i = 0; i < fan_out; ++i)
+    ps[i].set_value(1);
+  boost::csbl::vector<boost::future<int> > res = all.get();
+  long sum = 0;
+  for (std::size_t i = 0; i < fan_out; ++i)
+    sum += res[i].get();
+  return sum;
+}
+
+bool bench(const char* title, gather how)
+{
+  bool ok = true;
+  Clock::time_point t0 = Clock::now();
+  for (int i = 0; i < rounds; ++i)
+    ok = round(how) == long(fan_out) && ok;
+  Clock::duration d = Clock::now() - t0;
+  std::cout << title << " of " << fan_out << " futures: "
+      << boost::chrono::duration<double, boost::micro>(d).count() / rounds << " us per round" << std::endl;
+  return ok;
+}
+
+int main()
+{
+  bool ok = true;
+  ok = bench("when_all", gather_when_all) && ok;
+  ok = bench("when_any", gather_when_any) && ok;
+  if (! ok)
+  {
+    std::cout << "ERROR= wrong sum" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
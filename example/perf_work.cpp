@@ -0,0 +1,118 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Measures the number of heap allocations and the time needed to store a closure in an executors::work
+// and to submit it to an executor.
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_QUEUE_DEPRECATE_OLD
+#define BOOST_THREAD_USES_CHRONO
+
+#include <boost/thread/executors/work.hpp>
+#include <boost/thread/executors/loop_executor.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/atomic.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+boost::atomic<unsigned long> allocations(0);
+
+#if defined BOOST_NO_CXX11_NOEXCEPT
+void* operator new(std::size_t size) throw(std::bad_alloc)
+#else
+void* operator new(std::size_t size)
+#endif
+{
+  ++allocations;
+  void* p = std::malloc(size ? size : 1);
+  if (! p) throw std::bad_alloc();
+  return p;
+}
+void operator delete(void* p) BOOST_NOEXCEPT_OR_NOTHROW
+{
+  std::free(p);
+}
+void operator delete(void* p, std::size_t) BOOST_NOEXCEPT_OR_NOTHROW
+{
+  std::free(p);
+}
+
+typedef boost::chrono::high_resolution_clock Clock;
+
+long counter = 0;
+
+/// a closure that fits in the internal buffer of work
+struct small_closure
+{
+  long* counter;
+  long a, b;
+  explicit small_closure(long* c) : counter(c), a(1), b(2) {}
+  void operator()() { *counter += a + b; }
+};
+
+/// a closure that doesn't fit in the internal buffer of work
+struct large_closure
+{
+  long* counter;
+  long data[16];
+  explicit large_closure(long* c) : counter(c) { for (int i = 0; i < 16; ++i) data[i] = i; }
+  void operator()() { *counter += data[15]; }
+};
+
+template <typename Closure>
+void bench_work(const char* title, unsigned n)
+{
+  unsigned long a0 = allocations;
+  Clock::time_point t0 = Clock::now();
+  for (unsigned i = 0; i < n; ++i)
+  {
+    Closure c(&counter);
+    boost::executors::work w(c);
+    boost::executors::work w2(boost::move(w));
+    w2();
+  }
+  Clock::duration d = Clock::now() - t0;
+  std::cout << title << ": " << double(allocations - a0) / n << " allocations, "
+      << boost::chrono::duration<double, boost::nano>(d).count() / n << " ns per work" << std::endl;
+}
+
+template <typename Executor, typename Closure>
+void bench_submit(const char* title, Executor& ex, unsigned n)
+{
+  unsigned long a0 = allocations;
+  Clock::time_point t0 = Clock::now();
+  for (unsigned i = 0; i < n; ++i)
+  {
+    Closure c(&counter);
+    ex.submit(c);
+  }
+  unsigned long submit_allocations = allocations - a0;
+  Clock::duration d = Clock::now() - t0;
+  std::cout << title << ": " << double(submit_allocations) / n << " allocations, "
+      << boost::chrono::duration<double, boost::nano>(d).count() / n << " ns per submit" << std::endl;
+}
+
+int main()
+{
+  const unsigned n = 1000000;
+  std::cout << "sizeof(work) = " << sizeof(boost::executors::work) << std::endl;
+  bench_work<small_closure>("small closure", n);
+  bench_work<large_closure>("large closure", n);
+  {
+    boost::loop_executor ex;
+    bench_submit<boost::loop_executor, small_closure>("loop_executor small closure", ex, n);
+    ex.run_queued_closures();
+    bench_submit<boost::loop_executor, large_closure>("loop_executor large closure", ex, n);
+    ex.run_queued_closures();
+  }
+  {
+    boost::basic_thread_pool ex(1);
+    bench_submit<boost::basic_thread_pool, small_closure>("basic_thread_pool small closure", ex, n);
+  }
+  return 0;
+}
@@ -0,0 +1,165 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Submits closures of several priorities to a priority_thread_pool, checks that the urgent ones overtake the bulk ones
+// already queued, that aging lets a starving closure run under a steady flow of urgent ones, and that the pool can be
+// used by async().
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+#define BOOST_THREAD_QUEUE_DEPRECATE_OLD
+
+#include <boost/thread/executors/priority_thread_pool.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/atomic.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <iostream>
+#include <vector>
+
+boost::mutex mtx;
+std::vector<int> order;
+
+struct record
+{
+  int id_;
+  explicit record(int id) : id_(id) {}
+  void operator()() const
+  {
+    boost::lock_guard<boost::mutex> lk(mtx);
+    order.push_back(id_);
+  }
+};
+
+boost::atomic<bool> gate_open(false);
+
+struct gate
+{
+  void operator()() const
+  {
+    while (! gate_open) boost::this_thread::sleep_for(boost::chrono::milliseconds(1));
+  }
+};
+
+boost::atomic<int> urgent_runs(0);
+boost::atomic<int> starving_run_at(-1);
+
+// keeps the pool busy with urgent closures, each one submitting the next
+struct urgent
+{
+  boost::priority_thread_pool* tp_;
+  int left_;
+  urgent(boost::priority_thread_pool& tp, int left) : tp_(&tp), left_(left) {}
+  void operator()() const
+  {
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(1));
+    ++urgent_runs;
+    if (left_ > 0) tp_->submit(0, urgent(*tp_, left_ - 1));
+  }
+};
+
+struct starving
+{
+  void operator()() const
+  {
+    starving_run_at = urgent_runs.load();
+  }
+};
+
+int answer()
+{
+  return 42;
+}
+
+bool wait_for_records(std::size_t n)
+{
+  for (int i = 0; i < 500; ++i)
+  {
+    {
+      boost::lock_guard<boost::mutex> lk(mtx);
+      if (order.size() >= n) return true;
+    }
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(10));
+  }
+  return false;
+}
+
+int main()
+{
+  try
+  {
+    {
+      // the urgent closures overtake the bulk ones queued before them, each level keeping its submission order
+      boost::priority_thread_pool tp(1, 3);
+      tp.submit(0, gate());
+      for (int i = 0; i < 4; ++i) tp.submit(2, record(200 + i));
+      for (int i = 0; i < 4; ++i) tp.submit(record(100 + i));
+      for (int i = 0; i < 4; ++i) tp.submit(0, record(i));
+      tp.submit(7, record(204));
+      gate_open = true;
+      if (! wait_for_records(13))
+      {
+        std::cout << "ERROR= closures not run" << std::endl;
+        return 1;
+      }
+      int expected[] = { 0, 1, 2, 3, 100, 101, 102, 103, 200, 201, 202, 203, 204 };
+      boost::lock_guard<boost::mutex> lk(mtx);
+      for (std::size_t i = 0; i < order.size(); ++i)
+      {
+        if (order[i] != expected[i])
+        {
+          std::cout << "ERROR= closures not run in priority order" << std::endl;
+          return 1;
+        }
+      }
+    }
+    {
+      // with aging, a bulk closure is run while the urgent ones keep coming
+      boost::priority_thread_pool tp(1, 2, boost::chrono::milliseconds(20));
+      tp.submit(0, urgent(tp, 200));
+      tp.submit(1, starving());
+      for (int i = 0; i < 500 && starving_run_at < 0; ++i)
+        boost::this_thread::sleep_for(boost::chrono::milliseconds(10));
+      if (starving_run_at < 0 || starving_run_at >= 200)
+      {
+        std::cout << "ERROR= aged closure starved" << std::endl;
+        return 1;
+      }
+    }
+    {
+      // the pool models the Executor concept
+      boost::priority_thread_pool tp;
+      boost::future<int> f = boost::async(tp, &answer);
+      if (f.get() != 42)
+      {
+        std::cout << "ERROR= async on a priority_thread_pool" << std::endl;
+        return 1;
+      }
+      tp.close();
+      try
+      {
+        tp.submit(0, record(0));
+        std::cout << "ERROR= closure submitted on a closed pool" << std::endl;
+        return 1;
+      }
+      catch (boost::sync_queue_is_closed&)
+      {
+      }
+    }
+  }
+  catch (std::exception& ex)
+  {
+    std::cout << "ERROR= " << ex.what() << "" << std::endl;
+    return 1;
+  }
+  catch (...)
+  {
+    std::cout << " ERROR= exception thrown" << std::endl;
+    return 2;
+  }
+  return 0;
+}
@@ -0,0 +1,194 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Schedules closures at a given time on a scheduled_thread_pool and on a scheduling_adaptor, checks that they are run
+// in due order and not before they are due, and measures the cost of scheduling many timeouts that are pending at once.
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+#define BOOST_THREAD_QUEUE_DEPRECATE_OLD
+
+#include <boost/thread/executors/scheduled_thread_pool.hpp>
+#include <boost/thread/executors/scheduling_adaptor.hpp>
+#include <boost/thread/executors/executor_adaptor.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/atomic.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <iostream>
+#include <vector>
+
+typedef boost::chrono::steady_clock Clock;
+
+boost::mutex mtx;
+std::vector<int> order;
+bool early = false;
+
+struct record
+{
+  int id_;
+  Clock::time_point due_;
+  record(int id, Clock::time_point due) : id_(id), due_(due) {}
+  void operator()() const
+  {
+    boost::lock_guard<boost::mutex> lk(mtx);
+    if (Clock::now() < due_) early = true;
+    order.push_back(id_);
+  }
+};
+
+boost::atomic<long> fired(0);
+
+struct fire
+{
+  void operator()() const
+  {
+    ++fired;
+  }
+};
+
+bool wait_for_records(std::size_t n)
+{
+  for (int i = 0; i < 500; ++i)
+  {
+    {
+      boost::lock_guard<boost::mutex> lk(mtx);
+      if (order.size() >= n) return true;
+    }
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(10));
+  }
+  return false;
+}
+
+bool in_due_order()
+{
+  boost::lock_guard<boost::mutex> lk(mtx);
+  for (std::size_t i = 0; i < order.size(); ++i)
+    if (order[i] != int(i)) return false;
+  return ! early;
+}
+
+int main()
+{
+  try
+  {
+    {
+      // closures scheduled out of order are run in due order, the ones due at the same time in submission order
+      boost::scheduled_thread_pool tp(1);
+      Clock::time_point now = Clock::now();
+      tp.submit_after(boost::chrono::milliseconds(60), record(3, now + boost::chrono::milliseconds(60)));
+      tp.submit_after(boost::chrono::milliseconds(20), record(0, now + boost::chrono::milliseconds(20)));
+      tp.submit_at(now + boost::chrono::milliseconds(40), record(1, now + boost::chrono::milliseconds(40)));
+      tp.submit_at(now + boost::chrono::milliseconds(40), record(2, now + boost::chrono::milliseconds(40)));
+      tp.submit_at(boost::chrono::system_clock::now() + boost::chrono::milliseconds(80),
+          record(4, now + boost::chrono::milliseconds(80)));
+      if (! wait_for_records(5) || ! in_due_order())
+      {
+        std::cout << "ERROR= closures run out of order or before they were due" << std::endl;
+        return 1;
+      }
+    }
+    {
+      // the closures scheduled before close() are still run, the later ones are refused
+      order.clear();
+      boost::executor_adaptor<boost::basic_thread_pool> ea(1);
+      boost::scheduling_adaptor<boost::executor> sa(ea);
+      sa.submit_after(boost::chrono::milliseconds(10), record(0, Clock::now()));
+      sa.close();
+      try
+      {
+        sa.submit_after(boost::chrono::milliseconds(10), record(1, Clock::now()));
+        std::cout << "ERROR= closure scheduled on a closed adaptor" << std::endl;
+        return 1;
+      }
+      catch (boost::sync_queue_is_closed&)
+      {
+      }
+      if (! wait_for_records(1) || ! in_due_order())
+      {
+        std::cout << "ERROR= closure scheduled before close not run" << std::endl;
+        return 1;
+      }
+    }
+    {
+      // a closure due after the underlying pool has been closed is run by the timer thread
+      order.clear();
+      boost::basic_thread_pool tp(1);
+      boost::scheduling_adaptor<boost::basic_thread_pool> sa(tp);
+      sa.submit_after(boost::chrono::milliseconds(50), record(0, Clock::now()));
+      tp.close();
+      if (! wait_for_records(1) || ! in_due_order())
+      {
+        std::cout << "ERROR= closure due after the pool was closed not run" << std::endl;
+        return 1;
+      }
+    }
+    {
+      // the timers pending when a scheduled_thread_pool is closed are still fired
+      order.clear();
+      boost::scheduled_thread_pool tp(2);
+      tp.submit_after(boost::chrono::milliseconds(50), record(0, Clock::now()));
+      tp.close();
+      try
+      {
+        tp.submit(fire());
+        std::cout << "ERROR= closure submitted on a closed pool" << std::endl;
+        return 1;
+      }
+      catch (boost::sync_queue_is_closed&)
+      {
+      }
+      if (! wait_for_records(1) || ! in_due_order())
+      {
+        std::cout << "ERROR= closure scheduled before close not run" << std::endl;
+        return 1;
+      }
+    }
+    {
+      // the destructor doesn't wait for the closures that are not due
+      Clock::time_point t0 = Clock::now();
+      {
+        boost::basic_thread_pool tp(1);
+        boost::scheduling_adaptor<boost::basic_thread_pool> sa(tp);
+        sa.submit_after(boost::chrono::seconds(60), fire());
+      }
+      if (fired != 0 || Clock::now() - t0 > boost::chrono::seconds(30))
+      {
+        std::cout << "ERROR= destructor waited for a closure not due" << std::endl;
+        return 1;
+      }
+    }
+    {
+      // many pending timeouts, as RPC deadlines
+      const long timeouts = 100000;
+      boost::scheduled_thread_pool tp(2);
+      Clock::time_point t0 = Clock::now();
+      for (long i = 0; i < timeouts; ++i)
+        tp.submit_after(boost::chrono::microseconds(200000 + (i * 7919) % 100000), fire());
+      Clock::duration d = Clock::now() - t0;
+      std::cout << timeouts << " pending timeouts: "
+          << boost::chrono::duration<double, boost::nano>(d).count() / timeouts << " ns per submit_after" << std::endl;
+      for (int i = 0; i < 500 && fired != timeouts; ++i)
+        boost::this_thread::sleep_for(boost::chrono::milliseconds(10));
+      if (fired != timeouts || tp.pending() != 0)
+      {
+        std::cout << "ERROR= " << fired << " timeouts fired instead of " << timeouts << std::endl;
+        return 1;
+      }
+    }
+  }
+  catch (std::exception& ex)
+  {
+    std::cout << "ERROR= " << ex.what() << "" << std::endl;
+    return 1;
+  }
+  catch (...)
+  {
+    std::cout << " ERROR= exception thrown" << std::endl;
+    return 2;
+  }
+  return 0;
+}
@@ -0,0 +1,92 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Runs many serial executors (strands) on a small thread pool and checks that the closures of each strand are executed
+// in submission order and never concurrently.
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+#define BOOST_THREAD_QUEUE_DEPRECATE_OLD
+
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/executors/serial_executor.hpp>
+#include <boost/thread/executors/executor_adaptor.hpp>
+#include <boost/atomic.hpp>
+#include <boost/chrono/chrono.hpp>
+
+#include <iostream>
+
+typedef boost::chrono::high_resolution_clock Clock;
+
+struct strand_state
+{
+  boost::atomic<int> active;
+  int next;
+  bool ok;
+  strand_state() : active(0), next(0), ok(true) {}
+};
+
+struct step
+{
+  strand_state* s_;
+  int i_;
+  step(strand_state* s, int i) : s_(s), i_(i) {}
+  void operator()()
+  {
+    if (s_->active.fetch_add(1) != 0) s_->ok = false;
+    if (s_->next != i_) s_->ok = false;
+    ++s_->next;
+    s_->active.fetch_sub(1);
+  }
+};
+
+int main()
+{
+  const int strands = 1000;
+  const int steps = 100;
+  try
+  {
+    strand_state* states = new strand_state[strands];
+    Clock::time_point t0 = Clock::now();
+    {
+      boost::executor_adaptor<boost::basic_thread_pool> pool(4);
+      boost::serial_executor* serials[strands];
+      for (int k = 0; k < strands; ++k)
+        serials[k] = new boost::serial_executor(pool);
+      for (int i = 0; i < steps; ++i)
+        for (int k = 0; k < strands; ++k)
+        {
+          step c(&states[k], i);
+          serials[k]->submit(c);
+        }
+      for (int k = 0; k < strands; ++k)
+        delete serials[k];
+    }
+    Clock::duration d = Clock::now() - t0;
+    std::cout << strands << " strands: "
+        << boost::chrono::duration<double, boost::nano>(d).count() / (long(strands) * steps) << " ns per closure" << std::endl;
+
+    bool ok = true;
+    for (int k = 0; k < strands; ++k)
+      ok = ok && states[k].ok && states[k].next == steps;
+    delete [] states;
+    if (! ok)
+    {
+      std::cout << "ERROR= closures run out of order or concurrently" << std::endl;
+      return 1;
+    }
+  }
+  catch (std::exception& ex)
+  {
+    std::cout << "ERROR= " << ex.what() << "" << std::endl;
+    return 1;
+  }
+  catch (...)
+  {
+    std::cout << " ERROR= exception thrown" << std::endl;
+    return 2;
+  }
+  return 0;
+}
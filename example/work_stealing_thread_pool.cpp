@@ -0,0 +1,129 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+#define BOOST_THREAD_USES_LOG_THREAD_ID
+#define BOOST_THREAD_QUEUE_DEPRECATE_OLD
+
+#include <boost/thread/executors/work_stealing_thread_pool.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/atomic.hpp>
+
+#include <iostream>
+#include <list>
+#include <algorithm>
+
+boost::atomic<int> counter(0);
+
+void p1()
+{
+  ++counter;
+}
+
+void at_th_entry(boost::work_stealing_thread_pool& )
+{
+}
+
+#if defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
+
+template<typename T>
+struct sorter
+{
+    boost::work_stealing_thread_pool pool;
+
+    std::list<T> do_sort(std::list<T> chunk_data)
+    {
+        if(chunk_data.empty())
+        {
+            return chunk_data;
+        }
+
+        std::list<T> result;
+        result.splice(result.begin(),chunk_data, chunk_data.begin());
+        T const& partition_val=*result.begin();
+
+        typename std::list<T>::iterator divide_point=
+            std::partition(chunk_data.begin(), chunk_data.end(), [&](T const& val){return val<partition_val;});
+
+        std::list<T> new_lower_chunk;
+        new_lower_chunk.splice(new_lower_chunk.end(), chunk_data, chunk_data.begin(), divide_point);
+
+        // submitted from a worker thread, the task goes to its local queue
+        boost::future<std::list<T> > new_lower = boost::async(pool, &sorter::do_sort, this, std::move(new_lower_chunk));
+
+        std::list<T> new_higher(do_sort(chunk_data));
+
+        result.splice(result.end(),new_higher);
+        while(!new_lower.is_ready())
+        {
+            pool.schedule_one_or_yield();
+        }
+
+        result.splice(result.begin(),new_lower.get());
+        return result;
+    }
+};
+
+bool sort_some()
+{
+  const int s = 1001;
+  std::list<int> lst;
+  for (int i=0; i<s;++i)
+    lst.push_back((i * 7919) % s);
+  sorter<int> srt;
+  std::list<int> r = srt.do_sort(lst);
+  lst.sort();
+  return r == lst;
+}
+#else
+bool sort_some()
+{
+  return true;
+}
+#endif
+
+int main()
+{
+  try
+  {
+    {
+      boost::work_stealing_thread_pool tp;
+      for (int i = 0; i < 100; ++i)
+        tp.submit(&p1);
+    }
+    if (counter != 100)
+    {
+      std::cout << "ERROR= " << counter << " closures run instead of 100" << std::endl;
+      return 1;
+    }
+    {
+      boost::work_stealing_thread_pool tp(4, at_th_entry);
+      for (int i = 0; i < 100; ++i)
+        tp.submit(&p1);
+    }
+    if (counter != 200)
+    {
+      std::cout << "ERROR= " << counter << " closures run instead of 200" << std::endl;
+      return 1;
+    }
+    if (! sort_some())
+    {
+      std::cout << "ERROR= wrong sort" << std::endl;
+      return 1;
+    }
+  }
+  catch (std::exception& ex)
+  {
+    std::cout << "ERROR= " << ex.what() << "" << std::endl;
+    return 1;
+  }
+  catch (...)
+  {
+    std::cout << " ERROR= exception thrown" << std::endl;
+    return 2;
+  }
+  return 0;
+}
@@ -70,14 +70,10 @@ namespace boost
       : size_(size), fct_(funct)
       {}
 
-      BOOST_THREAD_MOVABLE(void_functor_barrier_reseter)
+      BOOST_THREAD_MOVABLE_ONLY(void_functor_barrier_reseter)
 
-      void_functor_barrier_reseter(void_functor_barrier_reseter const& other) BOOST_NOEXCEPT :
-      size_(other.size_), fct_(other.fct_)
-      {
-      }
       void_functor_barrier_reseter(BOOST_THREAD_RV_REF(void_functor_barrier_reseter) other) BOOST_NOEXCEPT :
-      size_(BOOST_THREAD_RV(other).size_), fct_(BOOST_THREAD_RV(other).fct_)
+      size_(BOOST_THREAD_RV(other).size_), fct_(boost::move(BOOST_THREAD_RV(other).fct_))
       {
       }
 
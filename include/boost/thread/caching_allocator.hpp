@@ -0,0 +1,273 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_CACHING_ALLOCATOR_HPP
+#define BOOST_THREAD_CACHING_ALLOCATOR_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/tss.hpp>
+
+#include <cstddef>
+#include <new>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace thread_detail
+{
+  /**
+   * Per-thread free lists of the blocks up to max_block_size bytes, by size classes of granularity bytes.
+   * A block freed on a thread goes to the cache of this thread, whatever the thread that allocated it.
+   */
+  class thread_block_cache
+  {
+  public:
+    BOOST_STATIC_CONSTANT(std::size_t, granularity = 16);
+    BOOST_STATIC_CONSTANT(std::size_t, max_block_size = 512);
+    BOOST_STATIC_CONSTANT(std::size_t, size_classes = max_block_size / granularity);
+  private:
+    struct node
+    {
+      node* next;
+    };
+    node* free_[size_classes];
+    std::size_t count_[size_classes];
+
+    thread_block_cache(thread_block_cache const&);
+    thread_block_cache& operator=(thread_block_cache const&);
+
+    static std::size_t size_class(std::size_t n)
+    {
+      return (n + granularity - 1) / granularity - 1;
+    }
+
+    /// the size of the blocks allocated for \c n bytes: the whole size class of the cacheable ones, as any cache
+    /// may file them under this class when they are freed.
+    static std::size_t block_size(std::size_t n)
+    {
+      return (n == 0 || n > max_block_size) ? n : (size_class(n) + 1) * granularity;
+    }
+  public:
+    thread_block_cache()
+    {
+      for (std::size_t i = 0; i < size_classes; ++i)
+      {
+        free_[i] = 0;
+        count_[i] = 0;
+      }
+    }
+    ~thread_block_cache()
+    {
+      for (std::size_t i = 0; i < size_classes; ++i)
+      {
+        while (free_[i])
+        {
+          node* n = free_[i];
+          free_[i] = n->next;
+          ::operator delete(n);
+        }
+      }
+    }
+
+    /// the cache of the calling thread, created on first use, or null once the thread has started to exit.
+    static thread_block_cache* instance();
+
+    /// takes a block of \c n bytes from the cache of the calling thread, or from the global operator new.
+    static void* allocate_block(std::size_t n)
+    {
+      thread_block_cache* cache = instance();
+      return cache ? cache->allocate(n) : ::operator new(block_size(n));
+    }
+
+    /// gives back a block of \c n bytes to the cache of the calling thread, or to the global operator delete.
+    static void deallocate_block(void* p, std::size_t n) BOOST_NOEXCEPT
+    {
+      thread_block_cache* cache = instance();
+      if (cache)
+        cache->deallocate(p, n);
+      else
+        ::operator delete(p);
+    }
+
+    void* allocate(std::size_t n)
+    {
+      if (n == 0 || n > max_block_size)
+        return ::operator new(n);
+      std::size_t c = size_class(n);
+      node* b = free_[c];
+      if (b == 0)
+        return ::operator new(block_size(n));
+      free_[c] = b->next;
+      --count_[c];
+      return b;
+    }
+
+    void deallocate(void* p, std::size_t n) BOOST_NOEXCEPT
+    {
+      if (n == 0 || n > max_block_size)
+      {
+        ::operator delete(p);
+        return;
+      }
+      std::size_t c = size_class(n);
+      if (count_[c] >= BOOST_THREAD_CACHING_ALLOCATOR_MAX_BLOCKS)
+      {
+        ::operator delete(p);
+        return;
+      }
+      node* b = static_cast<node*>(p);
+      b->next = free_[c];
+      free_[c] = b;
+      ++count_[c];
+    }
+  };
+
+#if ! defined BOOST_NO_CXX11_THREAD_LOCAL
+  /// the native thread local pointer to the cache of each thread, owned by a thread local object destroyed when the thread exits.
+  template <typename Cache>
+  struct thread_local_cache
+  {
+    struct owner
+    {
+      ~owner()
+      {
+        delete ptr;
+        ptr = 0;
+        exited = true;
+      }
+    };
+    static thread_local Cache* ptr;
+    static thread_local bool exited;
+    static thread_local owner own;
+
+    static Cache* get()
+    {
+      Cache* c = ptr;
+      if (c == 0 && ! exited)
+      {
+        // the first use of own registers its destruction at thread exit.
+        (void)&own;
+        c = ptr = new Cache();
+      }
+      return c;
+    }
+  };
+  template <typename Cache>
+  thread_local Cache* thread_local_cache<Cache>::ptr = 0;
+  template <typename Cache>
+  thread_local bool thread_local_cache<Cache>::exited = false;
+  template <typename Cache>
+  thread_local typename thread_local_cache<Cache>::owner thread_local_cache<Cache>::own;
+
+  inline thread_block_cache* thread_block_cache::instance()
+  {
+    return thread_local_cache<thread_block_cache>::get();
+  }
+#else
+  inline thread_block_cache* thread_block_cache::instance()
+  {
+    // never destroyed, so that the blocks released by static objects can still be cached.
+    static thread_specific_ptr<thread_block_cache>* caches = new thread_specific_ptr<thread_block_cache>();
+    thread_block_cache* cache = caches->get();
+    if (cache == 0)
+    {
+      cache = new thread_block_cache();
+      caches->reset(cache);
+    }
+    return cache;
+  }
+#endif
+}
+
+  /**
+   * Allocator taking the small blocks from a per-thread cache of freed blocks, so that the allocation and the
+   * deallocation of a block of a frequently used size don't call the global operator new/delete.
+   * All the instances are equivalent.
+   */
+  template <typename T>
+  class caching_allocator
+  {
+  public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+      typedef caching_allocator<U> other;
+    };
+
+    caching_allocator() BOOST_NOEXCEPT {}
+    template <typename U>
+    caching_allocator(caching_allocator<U> const&) BOOST_NOEXCEPT {}
+
+    pointer address(reference x) const { return &x; }
+    const_pointer address(const_reference x) const { return &x; }
+    size_type max_size() const BOOST_NOEXCEPT { return size_type(-1) / sizeof(T); }
+
+    /**
+     * \b Effects: Allocates room for \c n objects of type \c T, taking a block from the cache of the calling thread
+     * when there is one of this size.
+     *
+     * \b Throws: \c std::bad_alloc if the memory can't be allocated.
+     */
+    pointer allocate(size_type n, const void* = 0)
+    {
+      return static_cast<pointer>(thread_detail::thread_block_cache::allocate_block(n * sizeof(T)));
+    }
+
+    /**
+     * \b Effects: Gives back the block to the cache of the calling thread, or to the global operator delete when the
+     * cache for this size is full.
+     */
+    void deallocate(pointer p, size_type n)
+    {
+      thread_detail::thread_block_cache::deallocate_block(p, n * sizeof(T));
+    }
+
+    void construct(pointer p, const_reference v) { ::new (static_cast<void*>(p)) T(v); }
+    void destroy(pointer p) { p->~T(); }
+  };
+
+  template <>
+  class caching_allocator<void>
+  {
+  public:
+    typedef void value_type;
+    typedef void* pointer;
+    typedef const void* const_pointer;
+
+    template <typename U>
+    struct rebind
+    {
+      typedef caching_allocator<U> other;
+    };
+
+    caching_allocator() BOOST_NOEXCEPT {}
+    template <typename U>
+    caching_allocator(caching_allocator<U> const&) BOOST_NOEXCEPT {}
+  };
+
+  template <typename T, typename U>
+  bool operator==(caching_allocator<T> const&, caching_allocator<U> const&) BOOST_NOEXCEPT
+  {
+    return true;
+  }
+  template <typename T, typename U>
+  bool operator!=(caching_allocator<T> const&, caching_allocator<U> const&) BOOST_NOEXCEPT
+  {
+    return false;
+  }
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
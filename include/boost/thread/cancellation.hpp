@@ -0,0 +1,389 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_CANCELLATION_HPP
+#define BOOST_THREAD_CANCELLATION_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/atomic.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/type_traits/decay.hpp>
+#include <boost/utility/result_of.hpp>
+#include <algorithm>
+#include <vector>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace detail
+{
+  /// the state shared by a cancellation_source and its tokens, and the shared states bound to them.
+  class cancellation_state
+  {
+    typedef weak_ptr<shared_state_base> bound_state;
+
+    mutex mtx_;
+    // the shared states to make ready on cancellation. They are not kept alive, so that a discarded future doesn't
+    // stay allocated until its source is cancelled or destroyed.
+    std::vector<bound_state> bound_;
+
+    static bool expired(bound_state const& st)
+    {
+      return st.expired();
+    }
+  public:
+    atomic<bool> cancelled_;
+
+    cancellation_state() : cancelled_(false) {}
+
+    /// makes \c st ready with \c future_cancelled on cancellation, or at once if it has already been cancelled.
+    void bind(shared_ptr<shared_state_base> const& st)
+    {
+      {
+        lock_guard<mutex> lk(mtx_);
+        if (! cancelled_.load(memory_order_relaxed))
+        {
+          if (bound_.size() == bound_.capacity())
+          {
+            // drops the discarded states before growing, so that a long lived source doesn't accumulate them.
+            bound_.erase(std::remove_if(bound_.begin(), bound_.end(), &cancellation_state::expired), bound_.end());
+          }
+          bound_.push_back(bound_state(st));
+          return;
+        }
+      }
+      st->mark_cancelled();
+    }
+
+    void cancel()
+    {
+      std::vector<bound_state> bound;
+      {
+        lock_guard<mutex> lk(mtx_);
+        cancelled_.store(true, memory_order_release);
+        bound.swap(bound_);
+      }
+      for (std::vector<bound_state>::iterator it = bound.begin(); it != bound.end(); ++it)
+      {
+        shared_ptr<shared_state_base> st = it->lock();
+        if (st)
+        {
+          st->mark_cancelled();
+        }
+      }
+    }
+  };
+
+  inline void bind_to_token(cancellation_token const& tk, shared_ptr<shared_state_base> const& st);
+}
+
+  /**
+   * A view of the cancellation requests of a cancellation_source, that can be copied into the work that has to
+   * stop when the source is cancelled. A default constructed token is never cancelled.
+   */
+  class cancellation_token
+  {
+    friend class cancellation_source;
+    friend void detail::bind_to_token(cancellation_token const&, shared_ptr<detail::shared_state_base> const&);
+    shared_ptr<detail::cancellation_state> state_;
+
+    explicit cancellation_token(shared_ptr<detail::cancellation_state> const& st) : state_(st) {}
+  public:
+    cancellation_token() BOOST_NOEXCEPT {}
+
+    /// \b Returns: whether the token is associated to a source, so that it can be cancelled.
+    bool can_be_cancelled() const BOOST_NOEXCEPT
+    {
+      return state_ != 0;
+    }
+
+    /// \b Returns: whether the source of the token has been cancelled.
+    bool is_cancelled() const BOOST_NOEXCEPT
+    {
+      return state_ && state_->cancelled_.load(memory_order_acquire);
+    }
+
+    /// \b Throws: \c future_cancelled if the source of the token has been cancelled.
+    void throw_if_cancelled() const
+    {
+      if (is_cancelled())
+      {
+        boost::throw_exception(future_cancelled());
+      }
+    }
+  };
+
+  /**
+   * The owner of the cancellation requests. Copies of a source share the same state, and all the tokens got from
+   * them are cancelled by cancel().
+   */
+  class cancellation_source
+  {
+    shared_ptr<detail::cancellation_state> state_;
+  public:
+    cancellation_source() : state_(boost::make_shared<detail::cancellation_state>()) {}
+
+    /// \b Returns: a token that is cancelled when this source is.
+    cancellation_token get_token() const
+    {
+      return cancellation_token(state_);
+    }
+
+    /**
+     * \b Effects: Requests the cancellation of the work holding the tokens of this source. The pending futures
+     * bound to them, those returned by \c async, \c then and \c packaged_task given a token, become ready with
+     * \c future_cancelled and their work is dropped if it has not started yet. The running work stops only if it
+     * polls its token.
+     *
+     * \b Throws: Whatever the continuations of the futures made ready throw when they are launched.
+     */
+    void cancel()
+    {
+      state_->cancel();
+    }
+
+    /// \b Returns: whether cancel() has been called.
+    bool is_cancelled() const BOOST_NOEXCEPT
+    {
+      return state_->cancelled_.load(memory_order_acquire);
+    }
+  };
+
+namespace detail
+{
+  /// a callable that checks its token before calling the wrapped one.
+  template <typename F>
+  class cancellable_function
+  {
+    cancellation_token token_;
+    F f_;
+  public:
+#if defined BOOST_NO_CXX11_VARIADIC_TEMPLATES || defined BOOST_NO_CXX11_RVALUE_REFERENCES
+    typedef typename boost::result_of<F()>::type result_type;
+#endif
+
+    cancellable_function(cancellation_token const& tk, F const& f) : token_(tk), f_(f) {}
+#if ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+    cancellable_function(cancellation_token const& tk, F&& f) : token_(tk), f_(boost::move(f)) {}
+#endif
+
+#if ! defined BOOST_NO_CXX11_VARIADIC_TEMPLATES && ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+    template <typename... Args>
+    typename boost::result_of<F(Args...)>::type operator()(Args&&... args)
+    {
+      token_.throw_if_cancelled();
+      return f_(boost::forward<Args>(args)...);
+    }
+#else
+    result_type operator()()
+    {
+      token_.throw_if_cancelled();
+      return f_();
+    }
+    // the executors call the closures they copied as const objects.
+    result_type operator()() const
+    {
+      token_.throw_if_cancelled();
+      return f_();
+    }
+#endif
+  };
+}
+
+  /**
+   * \b Returns: a callable that calls \c f with its arguments unless \c tk is cancelled, in which case it throws
+   * \c future_cancelled instead.
+   *
+   * \b Notes: Given to \c async, \c then, \c packaged_task or to an executor's \c submit, the wrapped function is
+   * dropped without running once \c tk is cancelled: the future of the task, or of the continuation, is then made
+   * ready with a \c future_cancelled exception, and the executors discard the exception of a plain closure. That
+   * future is made ready only once the wrapped function is called; the overloads of \c async, \c then and
+   * \c packaged_task taking the token make it ready on cancellation. Only the nullary form is provided without
+   * variadic templates and rvalue references.
+   */
+  template <typename F>
+  detail::cancellable_function<typename decay<F>::type>
+  cancellable(cancellation_token const& tk, BOOST_THREAD_FWD_REF(F) f)
+  {
+    return detail::cancellable_function<typename decay<F>::type>(tk, boost::forward<F>(f));
+  }
+
+namespace detail
+{
+  inline void bind_to_token(cancellation_token const& tk, shared_ptr<shared_state_base> const& st)
+  {
+    if (tk.state_)
+    {
+      tk.state_->bind(st);
+    }
+  }
+}
+
+  ////////////////////////////////
+  // template <class F>
+  // packaged_task(cancellation_token tk, F&& f);
+  ////////////////////////////////
+
+  /**
+   * \b Effects: Constructs a \c packaged_task running \c cancellable(tk, f). Its future becomes ready with
+   * \c future_cancelled as soon as \c tk is cancelled, and the task is then dropped when invoked.
+   */
+#if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK
+  #if defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
+  template <typename R, typename ...ArgTypes>
+  template <class F>
+  packaged_task<R(ArgTypes...)>::packaged_task(cancellation_token tk, BOOST_THREAD_FWD_REF(F) f)
+  #else
+  template <typename R>
+  template <class F>
+  packaged_task<R()>::packaged_task(cancellation_token tk, BOOST_THREAD_FWD_REF(F) f)
+  #endif
+#else
+  template <typename R>
+  template <class F>
+  packaged_task<R>::packaged_task(cancellation_token tk, BOOST_THREAD_FWD_REF(F) f)
+#endif
+  : future_obtained(false)
+  {
+    packaged_task pt(cancellable(tk, boost::forward<F>(f)));
+    // takes the state, so that pt doesn't break its promise on destruction.
+    task.swap(pt.task);
+    detail::bind_to_token(tk, task);
+  }
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION && ! defined BOOST_NO_CXX11_VARIADIC_TEMPLATES && ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+  ////////////////////////////////
+  // template<typename F>
+  // auto future<R>::then(cancellation_token tk, launch policy, F&& func) -> BOOST_THREAD_FUTURE<decltype(func(*this))>;
+  ////////////////////////////////
+
+  /**
+   * \b Effects: As \c then(policy, cancellable(tk, func)), but the returned future becomes ready with
+   * \c future_cancelled as soon as \c tk is cancelled, even if this future never becomes ready.
+   */
+  template <typename R>
+  template <typename F>
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type>
+  BOOST_THREAD_FUTURE<R>::then(cancellation_token tk, launch policy, BOOST_THREAD_FWD_REF(F) func) {
+    typedef typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type future_type;
+    BOOST_THREAD_FUTURE<future_type> res = this->then(policy, cancellable(tk, boost::forward<F>(func)));
+    detail::bind_to_token(tk, res.future_);
+    return boost::move(res);
+  }
+
+  template <typename R>
+  template <typename F>
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future<R>)>::type>
+  shared_future<R>::then(cancellation_token tk, launch policy, BOOST_THREAD_FWD_REF(F) func) {
+    typedef typename boost::result_of<F(shared_future<R>)>::type future_type;
+    BOOST_THREAD_FUTURE<future_type> res = this->then(policy, cancellable(tk, boost::forward<F>(func)));
+    detail::bind_to_token(tk, res.future_);
+    return boost::move(res);
+  }
+
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+  ////////////////////////////////
+  // template<typename Ex, typename F>
+  // auto future<R>::then(cancellation_token tk, Ex& ex, F&& func) -> BOOST_THREAD_FUTURE<decltype(func(*this))>;
+  ////////////////////////////////
+
+  /**
+   * \b Effects: As \c then(ex, cancellable(tk, func)), but the returned future becomes ready with
+   * \c future_cancelled as soon as \c tk is cancelled, and the continuation queued on \c ex is then dropped.
+   */
+  template <typename R>
+  template <typename Ex, typename F>
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type>
+  BOOST_THREAD_FUTURE<R>::then(cancellation_token tk, Ex& ex, BOOST_THREAD_FWD_REF(F) func) {
+    typedef typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type future_type;
+    BOOST_THREAD_FUTURE<future_type> res = this->then(ex, cancellable(tk, boost::forward<F>(func)));
+    detail::bind_to_token(tk, res.future_);
+    return boost::move(res);
+  }
+
+  template <typename R>
+  template <typename Ex, typename F>
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future<R>)>::type>
+  shared_future<R>::then(cancellation_token tk, Ex& ex, BOOST_THREAD_FWD_REF(F) func) {
+    typedef typename boost::result_of<F(shared_future<R>)>::type future_type;
+    BOOST_THREAD_FUTURE<future_type> res = this->then(ex, cancellable(tk, boost::forward<F>(func)));
+    detail::bind_to_token(tk, res.future_);
+    return boost::move(res);
+  }
+#endif
+#endif
+
+#if ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+  ////////////////////////////////
+  // template <class F>
+  // future<R> async(cancellation_token tk, launch policy, F&& f);
+  ////////////////////////////////
+
+  /**
+   * \b Effects: As \c async(policy, cancellable(tk, f)), but the returned future becomes ready with
+   * \c future_cancelled as soon as \c tk is cancelled, and the task is then dropped if it has not started.
+   *
+   * \b Notes: With \c launch::async the task is a \c packaged_task, so that the returned future doesn't wait for it on
+   * destruction.
+   */
+  template <class F>
+  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type()>::type>
+  async(cancellation_token tk, launch policy, BOOST_THREAD_FWD_REF(F) f) {
+    typedef typename boost::result_of<typename decay<F>::type()>::type R;
+#if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK
+    typedef packaged_task<R()> packaged_task_type;
+#else
+    typedef packaged_task<R> packaged_task_type;
+#endif
+
+    if (underlying_cast<int>(policy) & int(launch::async)) {
+      packaged_task_type pt(tk, boost::forward<F>(f));
+      BOOST_THREAD_FUTURE<R> ret = pt.get_future();
+      ret.set_async();
+#if defined BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR
+      executors::default_executor().submit(boost::move(pt));
+#else
+      boost::thread( boost::move(pt) ).detach();
+#endif
+      return boost::move(ret);
+    }
+    BOOST_THREAD_FUTURE<R> ret = boost::async(policy, cancellable(tk, boost::forward<F>(f)));
+    detail::bind_to_token(tk, ret.future_);
+    return boost::move(ret);
+  }
+
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+  ////////////////////////////////
+  // template <class Executor, class F>
+  // future<R> async(cancellation_token tk, Executor& ex, F&& f);
+  ////////////////////////////////
+
+  /**
+   * \b Effects: As \c async(ex, cancellable(tk, f)), but the returned future becomes ready with
+   * \c future_cancelled as soon as \c tk is cancelled, and the task queued on \c ex is then dropped.
+   */
+  template <class Executor, class F>
+  BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type()>::type>
+  async(cancellation_token tk, Executor& ex, BOOST_THREAD_FWD_REF(F) f) {
+    typedef typename boost::result_of<typename decay<F>::type()>::type R;
+    BOOST_THREAD_FUTURE<R> ret = boost::async(ex, cancellable(tk, boost::forward<F>(f)));
+    detail::bind_to_token(tk, ret.future_);
+    return boost::move(ret);
+  }
+#endif
+#endif
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -126,6 +126,34 @@
 // http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2007/n2444.html#Appendix
 #define BOOST_THREAD_ONCE_FAST_EPOCH
 #endif
+
+// Number of times an idle thread pool worker polls for work before blocking.
+#if ! defined BOOST_THREAD_POOL_SPIN_COUNT
+#define BOOST_THREAD_POOL_SPIN_COUNT 64
+#endif
+
+// Number of times the waiting operations of the lock-free queues poll the queue, yielding between polls, before blocking.
+#if ! defined BOOST_THREAD_QUEUE_SPIN_COUNT
+#define BOOST_THREAD_QUEUE_SPIN_COUNT 16
+#endif
+
+// Size of the internal buffer of the type-erased closures (executors::work), larger closures are allocated.
+#if ! defined BOOST_THREAD_NULLARY_FUNCTION_BUFFER_SIZE
+#define BOOST_THREAD_NULLARY_FUNCTION_BUFFER_SIZE (6 * sizeof(void*))
+#endif
+
+// async(launch::async, f) and the async continuations run on executors::default_executor() instead of on a new thread.
+#if defined BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR && ! defined BOOST_THREAD_PROVIDES_EXECUTORS
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+#endif
+// Number of threads of the thread pool used as default executor.
+#if ! defined BOOST_THREAD_DEFAULT_EXECUTOR_THREAD_COUNT
+#define BOOST_THREAD_DEFAULT_EXECUTOR_THREAD_COUNT (thread::hardware_concurrency())
+#endif
+// Number of freed blocks of each size kept by the per-thread cache of caching_allocator.
+#if ! defined BOOST_THREAD_CACHING_ALLOCATOR_MAX_BLOCKS
+#define BOOST_THREAD_CACHING_ALLOCATOR_MAX_BLOCKS 64
+#endif
 #if BOOST_THREAD_VERSION==2
 
 // PROVIDE_PROMISE_LAZY
@@ -248,16 +276,6 @@
 #endif
 #endif
 
-#if ! defined BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY \
- && ! defined BOOST_THREAD_DONT_PROVIDE_FUTURE_WHEN_ALL_WHEN_ANY
-
-#if ! defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && \
-    ! defined(BOOST_NO_CXX11_HDR_TUPLE)
-
-#define BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY
-#endif
-#endif
-
 //    ! defined(BOOST_NO_SFINAE_EXPR) &&
 //    ! defined(BOOST_NO_CXX11_RVALUE_REFERENCES) &&
 //    ! defined(BOOST_NO_CXX11_AUTO) &&
@@ -285,6 +303,29 @@
 #define BOOST_THREAD_PROVIDES_FUTURE_UNWRAP
 #endif
 
+// FUTURE_WHEN_ALL_WHEN_ANY: when_all/when_any are made ready by continuations of the futures.
+#if ! defined BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY \
+ && ! defined BOOST_THREAD_DONT_PROVIDE_FUTURE_WHEN_ALL_WHEN_ANY
+
+#if ! defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && \
+    ! defined(BOOST_NO_CXX11_HDR_TUPLE) && \
+    defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+
+#define BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY
+#endif
+#endif
+
+// FUTURE_COROUTINES: co_await on the futures, resumed by a continuation of the shared state.
+#if ! defined BOOST_THREAD_PROVIDES_FUTURE_COROUTINES \
+ && ! defined BOOST_THREAD_DONT_PROVIDE_FUTURE_COROUTINES
+
+#if defined __cpp_impl_coroutine && __cpp_impl_coroutine >= 201902L && \
+    defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+
+#define BOOST_THREAD_PROVIDES_FUTURE_COROUTINES
+#endif
+#endif
+
 // FUTURE_INVALID_AFTER_GET
 #if ! defined BOOST_THREAD_PROVIDES_FUTURE_INVALID_AFTER_GET \
  && ! defined BOOST_THREAD_DONT_PROVIDE_FUTURE_INVALID_AFTER_GET
@@ -11,29 +11,70 @@
 #define BOOST_THREAD_DETAIL_NULLARY_FUNCTION_HPP
 
 #include <boost/config.hpp>
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
 #include <boost/thread/detail/memory.hpp>
 #include <boost/thread/detail/move.hpp>
-#include <boost/smart_ptr/shared_ptr.hpp>
 #include <boost/type_traits/decay.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/type_with_alignment.hpp>
+#include <boost/type_traits/is_nothrow_move_constructible.hpp>
+#include <boost/type_traits/has_trivial_copy.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/assert.hpp>
+#include <boost/core/enable_if.hpp>
+#include <new>
 
 namespace boost
 {
   namespace detail
   {
 
+    /**
+     * A move-only type-erased nullary function.
+     *
+     * Callables that fit in BOOST_THREAD_NULLARY_FUNCTION_BUFFER_SIZE bytes and whose move constructor doesn't throw
+     * are stored in an internal buffer, the others are allocated on the heap.
+     */
     template <typename F>
     class nullary_function;
-    template <>
-    class nullary_function<void()>
+    template <typename R>
+    class nullary_function<R()>
     {
+      typedef typename aligned_storage<BOOST_THREAD_NULLARY_FUNCTION_BUFFER_SIZE,
+          alignment_of<max_align>::value>::type buffer_type;
+
+      template <typename F>
+      struct move_is_safe
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+        : integral_constant<bool, is_nothrow_move_constructible<F>::value>
+#else
+        : integral_constant<bool, has_trivial_copy<F>::value>
+#endif
+      {
+      };
+
+      template <typename Impl, typename F>
+      struct use_buffer
+      {
+        BOOST_STATIC_CONSTANT(bool, value = (
+            sizeof(Impl) <= sizeof(buffer_type)
+            && alignment_of<Impl>::value <= alignment_of<buffer_type>::value
+            && move_is_safe<F>::value
+        ));
+      };
+
       struct impl_base
       {
-        virtual void call()=0;
+        virtual R call()=0;
+        /// move constructs a copy of this on the given storage
+        virtual impl_base* move_to(void* storage)=0;
         virtual ~impl_base()
         {
         }
       };
-      shared_ptr<impl_base> impl;
       template <typename F>
       struct impl_type: impl_base
       {
@@ -47,160 +88,185 @@ namespace boost
           : f(boost::move(f_))
         {}
 
-        void call()
+        R call()
+        {
+          return f();
+        }
+        impl_base* move_to(void* storage)
+        {
+          return move_to(storage, integral_constant<bool, use_buffer<impl_type, F>::value>());
+        }
+        impl_base* move_to(void* storage, true_type)
+        {
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+          return new (storage) impl_type(boost::move(f));
+#else
+          return new (storage) impl_type(f);
+#endif
+        }
+        impl_base* move_to(void* , false_type)
         {
-          f();
+          // heap allocated callables are never moved
+          BOOST_ASSERT(false);
+          return 0;
         }
       };
       struct impl_type_ptr: impl_base
       {
-        void (*f)();
-        impl_type_ptr(void (*f_)())
+        R (*f)();
+        impl_type_ptr(R (*f_)())
           : f(f_)
         {}
-        void call()
+        R call()
+        {
+          return f();
+        }
+        impl_base* move_to(void* storage)
         {
-          f();
+          return new (storage) impl_type_ptr(f);
         }
       };
-    public:
-      BOOST_THREAD_MOVABLE(nullary_function)
 
-      explicit nullary_function(void (*f)()):
-      impl(new impl_type_ptr(f))
-      {}
+      buffer_type buffer;
+      impl_base* impl;
 
-#ifdef BOOST_NO_CXX11_RVALUE_REFERENCES
-      template<typename F>
-      explicit nullary_function(F& f):
-      impl(new impl_type<F>(f))
-      {}
-#endif
-      template<typename F>
-      nullary_function(BOOST_THREAD_RV_REF(F) f):
-      impl(new impl_type<typename decay<F>::type>(thread_detail::decay_copy(boost::forward<F>(f))))
-      {}
+      bool is_local() const BOOST_NOEXCEPT
+      {
+        return static_cast<const void*>(impl) == static_cast<const void*>(&buffer);
+      }
 
-      nullary_function()
-        : impl()
+      template <typename F>
+      void construct(BOOST_THREAD_RV_REF(F) f)
       {
+        construct<F>(boost::move(f), integral_constant<bool, use_buffer<impl_type<F>, F>::value>());
       }
-      nullary_function(nullary_function const& other) BOOST_NOEXCEPT :
-      impl(other.impl)
+      template <typename F>
+      void construct(BOOST_THREAD_RV_REF(F) f, true_type)
       {
+        impl = new (&buffer) impl_type<F>(boost::move(f));
       }
-      nullary_function(BOOST_THREAD_RV_REF(nullary_function) other) BOOST_NOEXCEPT :
-      impl(BOOST_THREAD_RV(other).impl)
+      template <typename F>
+      void construct(BOOST_THREAD_RV_REF(F) f, false_type)
       {
-        BOOST_THREAD_RV(other).impl.reset();
+        impl = new impl_type<F>(boost::move(f));
       }
-      ~nullary_function()
+#ifdef BOOST_NO_CXX11_RVALUE_REFERENCES
+      template <typename F>
+      void construct_copy(F& f)
       {
+        construct_copy(f, integral_constant<bool, use_buffer<impl_type<F>, F>::value>());
       }
-
-      nullary_function& operator=(nullary_function const& other) BOOST_NOEXCEPT
+      template <typename F>
+      void construct_copy(F& f, true_type)
       {
-        impl=other.impl;
-        return *this;
+        impl = new (&buffer) impl_type<F>(f);
       }
-      nullary_function& operator=(BOOST_THREAD_RV_REF(nullary_function) other) BOOST_NOEXCEPT
+      template <typename F>
+      void construct_copy(F& f, false_type)
       {
-        impl=BOOST_THREAD_RV(other).impl;
-        BOOST_THREAD_RV(other).impl.reset();
-        return *this;
+        impl = new impl_type<F>(f);
       }
+#endif
 
-
-      void operator()()
-      { impl->call();}
-
-    };
-
-    template <typename R>
-    class nullary_function<R()>
-    {
-      struct impl_base
+      void move_from(nullary_function& other) BOOST_NOEXCEPT
       {
-        virtual R call()=0;
-        virtual ~impl_base()
+        if (other.is_local())
         {
+          impl = other.impl->move_to(&buffer);
+          other.destroy();
         }
-      };
-      shared_ptr<impl_base> impl;
-      template <typename F>
-      struct impl_type: impl_base
-      {
-        F f;
-#ifdef BOOST_NO_CXX11_RVALUE_REFERENCES
-        impl_type(F &f_)
-          : f(f_)
-        {}
-#endif
-        impl_type(BOOST_THREAD_RV_REF(F) f_)
-          : f(boost::move(f_))
-        {}
-
-        R call()
+        else
         {
-          return f();
+          impl = other.impl;
+          other.impl = 0;
         }
-      };
-      struct impl_type_ptr: impl_base
-      {
-        R (*f)();
-        impl_type_ptr(R (*f_)())
-          : f(f_)
-        {}
+      }
 
-        R call()
+      void destroy() BOOST_NOEXCEPT
+      {
+        if (is_local())
         {
-          return f();
+          impl->~impl_base();
         }
-      };
+        else
+        {
+          delete impl;
+        }
+        impl = 0;
+      }
+
+      struct dummy;
     public:
-      BOOST_THREAD_MOVABLE(nullary_function)
+      BOOST_THREAD_MOVABLE_ONLY(nullary_function)
 
-      nullary_function(R (*f)()):
-      impl(new impl_type_ptr(f))
+      explicit nullary_function(R (*f)()):
+      impl(new (&buffer) impl_type_ptr(f))
       {}
+
 #ifdef BOOST_NO_CXX11_RVALUE_REFERENCES
       template<typename F>
-      nullary_function(F& f):
-      impl(new impl_type<F>(f))
-      {}
+      explicit nullary_function(F& f):
+      impl(0)
+      {
+        construct_copy(f);
+      }
 #endif
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+      template<typename F>
+      nullary_function(F&& f
+          , typename disable_if<is_same<typename decay<F>::type, nullary_function>, dummy* >::type=0
+      ):
+      impl(0)
+      {
+        construct<typename decay<F>::type>(thread_detail::decay_copy(boost::forward<F>(f)));
+      }
+#else
       template<typename F>
       nullary_function(BOOST_THREAD_RV_REF(F) f):
-      impl(new impl_type<typename decay<F>::type>(thread_detail::decay_copy(boost::forward<F>(f))))
-      {}
-
-      nullary_function(nullary_function const& other) BOOST_NOEXCEPT :
-      impl(other.impl)
+      impl(0)
       {
+        construct<F>(f);
       }
-      nullary_function(BOOST_THREAD_RV_REF(nullary_function) other) BOOST_NOEXCEPT :
-      impl(BOOST_THREAD_RV(other).impl)
+#endif
+
+      nullary_function() BOOST_NOEXCEPT
+        : impl(0)
       {
-        BOOST_THREAD_RV(other).impl.reset();
       }
-      nullary_function()
-        : impl()
+      nullary_function(BOOST_THREAD_RV_REF(nullary_function) other) BOOST_NOEXCEPT :
+      impl(0)
       {
+        move_from(BOOST_THREAD_RV(other));
       }
       ~nullary_function()
       {
+        destroy();
       }
 
-      nullary_function& operator=(nullary_function const& other) BOOST_NOEXCEPT
+      nullary_function& operator=(BOOST_THREAD_RV_REF(nullary_function) other) BOOST_NOEXCEPT
       {
-        impl=other.impl;
+        if (this != &BOOST_THREAD_RV(other))
+        {
+          destroy();
+          move_from(BOOST_THREAD_RV(other));
+        }
         return *this;
       }
-      nullary_function& operator=(BOOST_THREAD_RV_REF(nullary_function) other) BOOST_NOEXCEPT
+
+      /**
+       * \b Returns: whether no callable is stored, as after it has been moved from.
+       */
+      bool empty() const BOOST_NOEXCEPT
       {
-        impl=BOOST_THREAD_RV(other).impl;
-        BOOST_THREAD_RV(other).impl.reset();
-        return *this;
+        return impl == 0;
+      }
+
+      /**
+       * \b Returns: whether the stored callable, if any, is stored in the internal buffer.
+       */
+      bool is_inline() const BOOST_NOEXCEPT
+      {
+        return impl != 0 && is_local();
       }
 
       R operator()()
@@ -208,6 +274,7 @@ namespace boost
 
     };
   }
+  BOOST_THREAD_DCL_MOVABLE_BEG(F) detail::nullary_function<F> BOOST_THREAD_DCL_MOVABLE_END
 }
 
 #endif // header
@@ -23,6 +23,7 @@
 #include <boost/thread/detail/is_convertible.hpp>
 #include <boost/assert.hpp>
 #include <list>
+#include <vector>
 #include <algorithm>
 #include <boost/core/ref.hpp>
 #include <boost/cstdint.hpp>
@@ -554,6 +555,8 @@ namespace boost
 
         static unsigned hardware_concurrency() BOOST_NOEXCEPT;
         static unsigned physical_concurrency() BOOST_NOEXCEPT;
+        static unsigned numa_node_count() BOOST_NOEXCEPT;
+        static std::vector<unsigned> numa_node_cpus(unsigned node);
 
 #define BOOST_THREAD_DEFINES_THREAD_NATIVE_HANDLE
         typedef detail::thread_data_base::native_handle_type native_handle_type;
@@ -606,6 +609,8 @@ namespace boost
         thread::id BOOST_THREAD_DECL get_id() BOOST_NOEXCEPT;
 #endif
 
+        unsigned BOOST_THREAD_DECL get_numa_node() BOOST_NOEXCEPT;
+
 #if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
         void BOOST_THREAD_DECL interruption_point();
         bool BOOST_THREAD_DECL interruption_enabled() BOOST_NOEXCEPT;
@@ -0,0 +1,185 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_DETAIL_WORK_STEALING_DEQUE_HPP
+#define BOOST_THREAD_DETAIL_WORK_STEALING_DEQUE_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/atomic.hpp>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace detail
+{
+  /**
+   * A single producer/multiple consumer deque.
+   *
+   * The owner thread pushes and takes at the bottom end while any other thread can steal from the top end.
+   * The element type must be trivially copyable (usually a pointer) as the elements are stored in atomic slots.
+   *
+   * This is the Chase-Lev deque of "Correct and Efficient Work-Stealing for Weak Memory Models", N.M. Le, A. Pop,
+   * A. Cohen, F. Zappa Nardelli.
+   */
+  template <typename T>
+  class work_stealing_deque
+  {
+    typedef boost::int64_t index_type;
+
+    struct circular_array
+    {
+      index_type const size_;
+      index_type const mask_;
+      atomic<T>* const data_;
+      /// the array this one replaced, kept alive as thieves could still be reading from it.
+      circular_array* const previous_;
+
+      circular_array(index_type size, circular_array* previous) :
+        size_(size), mask_(size - 1), data_(new atomic<T>[size]), previous_(previous)
+      {
+      }
+      ~circular_array()
+      {
+        delete[] data_;
+        delete previous_;
+      }
+      T get(index_type i) const
+      {
+        return data_[i & mask_].load(memory_order_relaxed);
+      }
+      void put(index_type i, T x)
+      {
+        data_[i & mask_].store(x, memory_order_relaxed);
+      }
+      circular_array* grow(index_type bottom, index_type top)
+      {
+        circular_array* res = new circular_array(2 * size_, this);
+        for (index_type i = top; i != bottom; ++i)
+        {
+          res->put(i, get(i));
+        }
+        return res;
+      }
+    };
+
+    char pad0_[64];
+    atomic<index_type> top_;
+    char pad1_[64 - sizeof(atomic<index_type>)];
+    atomic<index_type> bottom_;
+    atomic<circular_array*> array_;
+
+  public:
+    BOOST_THREAD_NO_COPYABLE(work_stealing_deque)
+
+    /**
+     * \b Requires: \c log_initial_size < 32
+     *
+     * \b Effects: creates an empty deque able to hold 2^log_initial_size elements before growing.
+     */
+    explicit work_stealing_deque(unsigned log_initial_size = 8) :
+      top_(0), bottom_(0), array_(new circular_array(index_type(1) << log_initial_size, 0))
+    {
+    }
+    ~work_stealing_deque()
+    {
+      delete array_.load(memory_order_relaxed);
+    }
+
+    /**
+     * \b Returns: whether the deque seemed empty at some point during the call.
+     */
+    bool empty() const
+    {
+      index_type b = bottom_.load(memory_order_relaxed);
+      index_type t = top_.load(memory_order_relaxed);
+      return b <= t;
+    }
+
+    /**
+     * \b Requires: called by the owner thread.
+     *
+     * \b Effects: push \c x at the bottom of the deque, growing the underlying array if needed.
+     */
+    void push(T x)
+    {
+      index_type b = bottom_.load(memory_order_relaxed);
+      index_type t = top_.load(memory_order_acquire);
+      circular_array* a = array_.load(memory_order_relaxed);
+      if (b - t > a->size_ - 1)
+      {
+        a = a->grow(b, t);
+        array_.store(a, memory_order_relaxed);
+      }
+      a->put(b, x);
+      atomic_thread_fence(memory_order_release);
+      bottom_.store(b + 1, memory_order_relaxed);
+    }
+
+    /**
+     * \b Requires: called by the owner thread.
+     *
+     * \b Effects: pop the element at the bottom of the deque, if any.
+     *
+     * \b Returns: whether an element has been popped into \c x.
+     */
+    bool take(T& x)
+    {
+      index_type b = bottom_.load(memory_order_relaxed) - 1;
+      circular_array* a = array_.load(memory_order_relaxed);
+      bottom_.store(b, memory_order_relaxed);
+      atomic_thread_fence(memory_order_seq_cst);
+      index_type t = top_.load(memory_order_relaxed);
+      if (t > b)
+      {
+        // empty
+        bottom_.store(b + 1, memory_order_relaxed);
+        return false;
+      }
+      x = a->get(b);
+      if (t == b)
+      {
+        // last element: race against the thieves
+        bool won = top_.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed);
+        bottom_.store(b + 1, memory_order_relaxed);
+        return won;
+      }
+      return true;
+    }
+
+    /**
+     * \b Effects: pop the element at the top of the deque, if any. Can be called by any thread.
+     *
+     * \b Returns: whether an element has been stolen into \c x.
+     * A \c false result can be spurious when the deque is contended.
+     */
+    bool steal(T& x)
+    {
+      index_type t = top_.load(memory_order_acquire);
+      atomic_thread_fence(memory_order_seq_cst);
+      index_type b = bottom_.load(memory_order_acquire);
+      if (t >= b)
+      {
+        return false;
+      }
+      circular_array* a = array_.load(memory_order_consume);
+      T res = a->get(t);
+      if (! top_.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed))
+      {
+        return false;
+      }
+      x = res;
+      return true;
+    }
+  };
+}
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
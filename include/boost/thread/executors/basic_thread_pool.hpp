@@ -17,6 +17,9 @@
 #include <boost/thread/sync_queue.hpp>
 #include <boost/thread/executors/work.hpp>
 #include <boost/thread/csbl/vector.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/atomic.hpp>
 
 #include <boost/config/abi_prefix.hpp>
 
@@ -37,6 +40,11 @@ namespace executors
 
     /// the thread safe work queue
     sync_queue<work > work_queue;
+    /// the number of submitted closures not yet finished, and where wait_idle() waits for it to drop to 0.
+    /// Declared before the threads, which use them until they are joined.
+    atomic<std::size_t> pending_;
+    mutex idle_mtx_;
+    condition_variable idle_cv_;
     /// A move aware vector
     thread_vector threads;
 
@@ -53,6 +61,7 @@ namespace executors
       {
         if (work_queue.try_pull_front(task) == queue_op_status::success)
         {
+          finished_guard g(*this);
           task();
           return true;
         }
@@ -79,56 +88,113 @@ namespace executors
         }
     }
   private:
+    /// counts the closure as finished when it goes out of scope, waking wait_idle() if it was the last one.
+    struct finished_guard
+    {
+      basic_thread_pool& pool_;
+      explicit finished_guard(basic_thread_pool& pool) : pool_(pool) {}
+      ~finished_guard()
+      {
+        pool_.finished_one();
+      }
+    };
+
+    void finished_one()
+    {
+      if (pending_.fetch_sub(1, memory_order_acq_rel) == 1)
+      {
+        // the waiters check pending_ under idle_mtx_, so taking it here ensures they don't miss the notification.
+        lock_guard<mutex> lk(idle_mtx_);
+        idle_cv_.notify_all();
+      }
+    }
+
+    /// pushes the closure counting it as pending until it has been executed.
+    void push(BOOST_THREAD_RV_REF(work) w)
+    {
+      pending_.fetch_add(1, memory_order_relaxed);
+      try
+      {
+        work_queue.push_back(boost::move(w));
+      }
+      catch (...)
+      {
+        finished_one();
+        throw;
+      }
+    }
 
     /**
-     * The main loop of the worker threads
+     * Effects: execute \c task, swallowing any exception it throws.
      */
-    void worker_thread()
+    void execute(work& task)
     {
-      while (!closed())
+      finished_guard g(*this);
+      try
+      {
+        task();
+      }
+      catch (...)
       {
-        schedule_one_or_yield();
       }
-      while (try_executing_one())
+    }
+
+    /**
+     * The idle strategy of the worker threads: spin on the queue at most \c BOOST_THREAD_POOL_SPIN_COUNT
+     * times and then park on it until either a new closure is submitted or the pool is closed.
+     * Returns once the pool is closed and all the pending closures have been executed.
+     */
+    void schedule_until_closed()
+    {
+      unsigned spins = 0;
+      for (;;)
       {
+        work task;
+        queue_op_status st = (spins < BOOST_THREAD_POOL_SPIN_COUNT)
+            ? work_queue.try_pull_front(task)
+            : work_queue.wait_pull_front(task);
+        if (st == queue_op_status::closed)
+        {
+          return;
+        }
+        if (st == queue_op_status::success)
+        {
+          spins = 0;
+          execute(task);
+        }
+        else
+        {
+          ++spins;
+          this_thread::yield();
+        }
       }
     }
+
+    /**
+     * The main loop of the worker threads
+     */
+    void worker_thread()
+    {
+      schedule_until_closed();
+    }
 #if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
     template <class AtThreadEntry>
     void worker_thread1(AtThreadEntry& at_thread_entry)
     {
       at_thread_entry(*this);
-      while (!closed())
-      {
-        schedule_one_or_yield();
-      }
-      while (try_executing_one())
-      {
-      }
+      schedule_until_closed();
     }
 #endif
     void worker_thread2(void(*at_thread_entry)(basic_thread_pool&))
     {
       at_thread_entry(*this);
-      while (!closed())
-      {
-        schedule_one_or_yield();
-      }
-      while (try_executing_one())
-      {
-      }
+      schedule_until_closed();
     }
     template <class AtThreadEntry>
     void worker_thread3(BOOST_THREAD_FWD_REF(AtThreadEntry) at_thread_entry)
     {
       at_thread_entry(*this);
-      while (!closed())
-      {
-        schedule_one_or_yield();
-      }
-      while (try_executing_one())
-      {
-      }
+      schedule_until_closed();
     }
     static void do_nothing_at_thread_entry(basic_thread_pool&) {}
 
@@ -142,6 +208,7 @@ namespace executors
      * \b Throws: Whatever exception is thrown while initializing the needed resources.
      */
     basic_thread_pool(unsigned const thread_count = thread::hardware_concurrency())
+    : pending_(0)
     {
       try
       {
@@ -171,6 +238,7 @@ namespace executors
 #if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
     template <class AtThreadEntry>
     basic_thread_pool( unsigned const thread_count, AtThreadEntry& at_thread_entry)
+    : pending_(0)
     {
       try
       {
@@ -190,6 +258,7 @@ namespace executors
     }
 #endif
     basic_thread_pool( unsigned const thread_count, void(*at_thread_entry)(basic_thread_pool&))
+    : pending_(0)
     {
       try
       {
@@ -209,6 +278,7 @@ namespace executors
     }
     template <class AtThreadEntry>
     basic_thread_pool( unsigned const thread_count, BOOST_THREAD_FWD_REF(AtThreadEntry) at_thread_entry)
+    : pending_(0)
     {
       try
       {
@@ -255,6 +325,23 @@ namespace executors
       return work_queue.closed();
     }
 
+    /**
+     * \b Effects: Blocks until all the closures submitted so far, and the ones they submit, have been executed. The
+     * pool stays open, so that it can be used to drain the pending work before an orderly shutdown or a checkpoint.
+     *
+     * \b Requires: Not to be called from a closure run by this pool, which would wait for itself.
+     *
+     * \b Synchronization: The completion of the closures happen before the return of \c wait_idle.
+     */
+    void wait_idle()
+    {
+      unique_lock<mutex> lk(idle_mtx_);
+      while (pending_.load(memory_order_acquire) != 0)
+      {
+        idle_cv_.wait(lk);
+      }
+    }
+
     /**
      * \b Requires: \c Closure is a model of \c Callable(void()) and a model of \c CopyConstructible/MoveConstructible.
      *
@@ -271,16 +358,14 @@ namespace executors
     template <typename Closure>
     void submit(Closure & closure)
     {
-      //work w ((closure));
-      //work_queue.push_back(boost::move(w));
-      work_queue.push_back(work(closure)); // todo check why this doesn't work
+      work w ((closure));
+      push(boost::move(w));
     }
 #endif
     void submit(void (*closure)())
     {
-      //work w ((closure));
-      //work_queue.push_back(boost::move(w));
-      work_queue.push_back(work(closure)); // todo check why this doesn't work
+      work w ((closure));
+      push(boost::move(w));
     }
 
 #if 0
@@ -288,14 +373,15 @@ namespace executors
     void submit(BOOST_THREAD_RV_REF(Closure) closure)
     {
       work w = boost::move(closure);
-      work_queue.push_back(boost::move(w));
+      push(boost::move(w));
       //work_queue.push_back(work(boost::move(closure))); // todo check why this doesn't work
     }
 #else
     template <typename Closure>
     void submit(BOOST_THREAD_FWD_REF(Closure) closure)
     {
-      work_queue.push_back(work(boost::forward<Closure>(closure)));
+      work w ((boost::forward<Closure>(closure)));
+      push(boost::move(w));
     }
 #endif
     /**
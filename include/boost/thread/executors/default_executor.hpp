@@ -0,0 +1,112 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_DEFAULT_EXECUTOR_HPP
+#define BOOST_THREAD_EXECUTORS_DEFAULT_EXECUTOR_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/executors/executor.hpp>
+#include <boost/thread/executors/executor_adaptor.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/tss.hpp>
+#include <boost/atomic.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace executors
+{
+namespace detail
+{
+  /// the executor installed by set_default_executor(), if any.
+  inline atomic<executor*>& default_executor_ptr()
+  {
+    static atomic<executor*> ptr(0);
+    return ptr;
+  }
+
+  inline void keep_builtin_default_pool(basic_thread_pool*) {}
+
+  /// the builtin thread pool if the calling thread is one of its threads, null otherwise.
+  inline thread_specific_ptr<basic_thread_pool>& builtin_default_pool_of_this_thread()
+  {
+    static thread_specific_ptr<basic_thread_pool> ptr(&keep_builtin_default_pool);
+    return ptr;
+  }
+
+  inline void enter_builtin_default_pool(basic_thread_pool& pool)
+  {
+    builtin_default_pool_of_this_thread().reset(&pool);
+  }
+
+  /// the thread pool used when no executor has been installed, created on first use.
+  inline executor& builtin_default_executor()
+  {
+    // created before the pool, so that it is destroyed once the threads have been joined.
+    builtin_default_pool_of_this_thread();
+    static executor_adaptor<basic_thread_pool> ex(BOOST_THREAD_DEFAULT_EXECUTOR_THREAD_COUNT, &enter_builtin_default_pool);
+    return ex;
+  }
+
+  /**
+   * \b Effects: If called from a thread of the builtin thread pool, runs the closures queued on it until \c done()
+   * returns \c true or there is no more queued closure.
+   */
+  template <typename Pred>
+  void run_queued_default_closures_until(Pred done)
+  {
+    basic_thread_pool* pool = builtin_default_pool_of_this_thread().get();
+    if (pool)
+    {
+      while (! done() && pool->try_executing_one())
+      {
+      }
+    }
+  }
+}
+
+  /**
+   * \b Returns: the executor installed by \c set_default_executor() or, if none, a process-wide
+   * \c basic_thread_pool with \c BOOST_THREAD_DEFAULT_EXECUTOR_THREAD_COUNT threads.
+   *
+   * \b Throws: Whatever exception is thrown while creating the thread pool.
+   *
+   * \b Notes: The futures returned by \c async() wait for their function on destruction. So that a function running
+   * on the process-wide thread pool can wait for the \c async() calls it makes without blocking all its threads, such
+   * a wait first runs the closures queued on the pool. An executor installed by \c set_default_executor() gets no
+   * such help: a function running on it that waits for another function submitted to it can deadlock once all its
+   * threads are waiting.
+   */
+  inline executor& default_executor()
+  {
+    executor* ex = detail::default_executor_ptr().load(memory_order_acquire);
+    if (ex)
+    {
+      return *ex;
+    }
+    return detail::builtin_default_executor();
+  }
+
+  /**
+   * \b Effects: installs \c ex as the default executor. A null pointer reinstalls the process-wide thread pool.
+   * The closures already submitted to the previous default executor are not moved.
+   *
+   * \b Returns: the previously installed executor, or a null pointer if none.
+   *
+   * \b Requires: \c ex outlives all the closures submitted to it.
+   */
+  inline executor* set_default_executor(executor* ex) BOOST_NOEXCEPT
+  {
+    return detail::default_executor_ptr().exchange(ex, memory_order_acq_rel);
+  }
+}
+using executors::default_executor;
+using executors::set_default_executor;
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -0,0 +1,438 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_ELASTIC_THREAD_POOL_HPP
+#define BOOST_THREAD_EXECUTORS_ELASTIC_THREAD_POOL_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/thread_only.hpp>
+#include <boost/thread/sync_queue.hpp>
+#include <boost/thread/executors/work.hpp>
+#include <boost/thread/csbl/vector.hpp>
+#include <boost/thread/csbl/deque.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/chrono/system_clocks.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace executors
+{
+  /**
+   * A thread pool whose number of threads follows the load, between a minimum and a maximum.
+   *
+   * A thread is added when the closures waiting for a worker outnumber the idle workers by \c grow_depth, so that
+   * the closures blocking on I/O don't starve the others. A worker that has been idle for the keep-alive period
+   * exits, unless the pool would have fewer than its minimum number of threads.
+   */
+  class elastic_thread_pool
+  {
+  public:
+    /// type-erasure to store the works to do
+    typedef  executors::work work;
+    /// the clock measuring the keep-alive period.
+    typedef chrono::steady_clock clock;
+  private:
+    typedef csbl::vector<thread> thread_vector;
+
+    unsigned const min_threads_;
+    unsigned const max_threads_;
+    clock::duration const keep_alive_;
+    std::size_t const grow_depth_;
+
+    /// protects all the members below.
+    mutex mtx_;
+    /// where the idle workers wait for closures.
+    condition_variable work_cv_;
+    /// where the destructor waits for the workers to exit.
+    condition_variable exit_cv_;
+    csbl::deque<work> queue_;
+    bool closed_;
+    /// the number of running workers, and of the ones waiting for closures.
+    unsigned live_;
+    unsigned idle_;
+    /// a slot per worker, not-a-thread when free.
+    thread_vector workers_;
+    /// the threads of the workers that have exited, to be joined.
+    thread_vector retired_;
+
+    /**
+     * Effects: execute \c task, swallowing any exception it throws.
+     */
+    static void execute(work& task)
+    {
+      try
+      {
+        task();
+      }
+      catch (...)
+      {
+      }
+    }
+
+    /**
+     * \b Requires: \c mtx_ is locked.
+     *
+     * \b Effects: starts a worker in a free slot.
+     *
+     * \b Throws: Whatever exception is thrown while creating the thread.
+     */
+    void spawn()
+    {
+      std::size_t slot = 0;
+      while (slot < workers_.size() && workers_[slot].joinable()) ++slot;
+      if (slot == workers_.size())
+      {
+        workers_.push_back(thread());
+      }
+      // the worker takes mtx_ before looking at its slot, so it is filled before the worker can retire.
+      thread th (&elastic_thread_pool::worker_thread, this, slot);
+      workers_[slot] = boost::move(th);
+      ++live_;
+    }
+
+    /**
+     * Effects: joins the threads of the workers that have exited.
+     */
+    void join_retired()
+    {
+      thread_vector retired;
+      {
+        lock_guard<mutex> lk(mtx_);
+        if (retired_.empty())
+        {
+          return;
+        }
+        retired.swap(retired_);
+        // the workers can't allocate when they retire.
+        retired_.reserve(max_threads_);
+      }
+      for (std::size_t i = 0; i < retired.size(); ++i)
+      {
+        retired[i].join();
+      }
+    }
+
+    /**
+     * The main loop of the worker in the slot \c slot: run the queued closures and wait for more. Returns once the
+     * pool is closed and there is no more closures to run, or once the worker has been idle for the keep-alive
+     * period while the pool has more than its minimum number of threads.
+     */
+    void worker_thread(std::size_t slot)
+    {
+      unique_lock<mutex> lk(mtx_);
+      for (;;)
+      {
+        if (! queue_.empty())
+        {
+          work task = boost::move(queue_.front());
+          queue_.pop_front();
+          lk.unlock();
+          execute(task);
+          lk.lock();
+          continue;
+        }
+        if (closed_)
+        {
+          break;
+        }
+        ++idle_;
+        bool timed_out = false;
+        clock::time_point const deadline = clock::now() + keep_alive_;
+        while (queue_.empty() && ! closed_ && ! timed_out)
+        {
+          if (live_ > min_threads_)
+          {
+            timed_out = (work_cv_.wait_until(lk, deadline) == cv_status::timeout);
+          }
+          else
+          {
+            work_cv_.wait(lk);
+          }
+        }
+        --idle_;
+        if (timed_out && queue_.empty() && ! closed_ && live_ > min_threads_)
+        {
+          // shrink: the thread can't join itself, the next submission or the destructor will.
+          retired_.push_back(boost::move(workers_[slot]));
+          break;
+        }
+      }
+      if (--live_ == 0)
+      {
+        exit_cv_.notify_all();
+      }
+    }
+
+    void push(work& w)
+    {
+      {
+        lock_guard<mutex> lk(mtx_);
+        if (closed_)
+        {
+          BOOST_THROW_EXCEPTION( sync_queue_is_closed() );
+        }
+        queue_.push_back(boost::move(w));
+        if (live_ == 0 || queue_.size() >= idle_ + grow_depth_)
+        {
+          if (live_ < max_threads_)
+          {
+            try
+            {
+              spawn();
+            }
+            catch (...)
+            {
+              // the closure would never run without any worker.
+              if (live_ == 0)
+              {
+                queue_.pop_back();
+                throw;
+              }
+            }
+          }
+        }
+        if (idle_ > 0)
+        {
+          work_cv_.notify_one();
+        }
+      }
+      join_retired();
+    }
+
+    void start(unsigned const thread_count)
+    {
+      lock_guard<mutex> lk(mtx_);
+      workers_.reserve(max_threads_);
+      retired_.reserve(max_threads_);
+      for (unsigned i = 0; i < thread_count; ++i)
+      {
+        spawn();
+      }
+    }
+
+  public:
+    /// elastic_thread_pool is not copyable.
+    BOOST_THREAD_NO_COPYABLE(elastic_thread_pool)
+
+    /**
+     * \b Effects: creates a thread pool with \c min_threads threads, that grows up to
+     * <c>max(min_threads, max_threads, 1)</c> threads when a closure has no idle worker and shrinks back when the added threads
+     * have been idle for a minute.
+     *
+     * \b Throws: Whatever exception is thrown while initializing the needed resources.
+     */
+    elastic_thread_pool(unsigned const min_threads = 1,
+        unsigned const max_threads = thread::hardware_concurrency())
+    : min_threads_(min_threads), max_threads_(max_threads > min_threads ? max_threads : (min_threads ? min_threads : 1)),
+      keep_alive_(chrono::duration_cast<clock::duration>(chrono::seconds(60))), grow_depth_(1),
+      closed_(false), live_(0), idle_(0)
+    {
+      try
+      {
+        start(min_threads_);
+      }
+      catch (...)
+      {
+        close();
+        join();
+        throw;
+      }
+    }
+
+    /**
+     * \b Requires: <c>grow_depth > 0</c>.
+     *
+     * \b Effects: creates a thread pool with \c min_threads threads, that grows up to
+     * <c>max(min_threads, max_threads, 1)</c> threads when the closures waiting for a worker outnumber the idle workers by
+     * \c grow_depth, and shrinks back when the added threads have been idle for \c keep_alive.
+     *
+     * \b Throws: Whatever exception is thrown while initializing the needed resources.
+     */
+    template <class Rep, class Period>
+    elastic_thread_pool(unsigned const min_threads, unsigned const max_threads,
+        chrono::duration<Rep, Period> const& keep_alive, unsigned const grow_depth = 1)
+    : min_threads_(min_threads), max_threads_(max_threads > min_threads ? max_threads : (min_threads ? min_threads : 1)),
+      keep_alive_(chrono::duration_cast<clock::duration>(keep_alive)), grow_depth_(grow_depth),
+      closed_(false), live_(0), idle_(0)
+    {
+      try
+      {
+        start(min_threads_);
+      }
+      catch (...)
+      {
+        close();
+        join();
+        throw;
+      }
+    }
+
+    /**
+     * \b Effects: Destroys the thread pool.
+     *
+     * \b Synchronization: The completion of all the closures happen before the completion of the \c elastic_thread_pool destructor.
+     */
+    ~elastic_thread_pool()
+    {
+      // signal to all the worker threads that there will be no more submissions.
+      close();
+      join();
+    }
+
+  private:
+    /**
+     * Effects: waits for all the workers to exit and joins their threads.
+     */
+    void join()
+    {
+      {
+        unique_lock<mutex> lk(mtx_);
+        while (live_ != 0)
+        {
+          exit_cv_.wait(lk);
+        }
+      }
+      for (std::size_t i = 0; i < workers_.size(); ++i)
+      {
+        if (workers_[i].joinable()) workers_[i].join();
+      }
+      join_retired();
+    }
+
+  public:
+    /**
+     * \b Effects: close the \c elastic_thread_pool for submissions.
+     * The worker threads will work until there is no more closures to run.
+     */
+    void close()
+    {
+      lock_guard<mutex> lk(mtx_);
+      closed_ = true;
+      work_cv_.notify_all();
+    }
+
+    /**
+     * \b Returns: whether the pool is closed for submissions.
+     */
+    bool closed()
+    {
+      lock_guard<mutex> lk(mtx_);
+      return closed_;
+    }
+
+    /**
+     * \b Returns: the number of threads of the pool, at the time of the call.
+     */
+    unsigned thread_count()
+    {
+      lock_guard<mutex> lk(mtx_);
+      return live_;
+    }
+
+    /**
+     * \b Returns: the number of threads waiting for closures, at the time of the call.
+     */
+    unsigned idle_count()
+    {
+      lock_guard<mutex> lk(mtx_);
+      return idle_;
+    }
+
+    /**
+     * \b Requires: \c Closure is a model of \c Callable(void()) and a model of \c CopyConstructible/MoveConstructible.
+     *
+     * \b Effects: The specified \c closure will be scheduled for execution at some point in the future, starting a
+     * new thread if the closures waiting for a worker outnumber the idle workers by \c grow_depth and the pool has
+     * less than its maximum number of threads.
+     * If invoked closure throws an exception the \c elastic_thread_pool will call \c std::terminate, as is the case with threads.
+     *
+     * \b Synchronization: completion of \c closure on a particular thread happens before destruction of thread's thread local variables.
+     *
+     * \b Throws: \c sync_queue_is_closed if the thread pool is closed.
+     * Whatever exception that can be throw while storing the closure, or while starting the first thread of the pool.
+     */
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit(Closure & closure)
+    {
+      work w((closure));
+      push(w);
+    }
+#endif
+    void submit(void (*closure)())
+    {
+      work w((closure));
+      push(w);
+    }
+
+    template <typename Closure>
+    void submit(BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w((boost::forward<Closure>(closure)));
+      push(w);
+    }
+
+    /**
+     * \b Effects: try to execute one task.
+     *
+     * \b Returns: whether a task has been executed.
+     */
+    bool try_executing_one()
+    {
+      work task;
+      {
+        lock_guard<mutex> lk(mtx_);
+        if (queue_.empty())
+        {
+          return false;
+        }
+        task = boost::move(queue_.front());
+        queue_.pop_front();
+      }
+      execute(task);
+      return true;
+    }
+
+    /**
+     * \b Effects: schedule one task or yields
+     */
+    void schedule_one_or_yield()
+    {
+      if ( ! try_executing_one())
+      {
+        this_thread::yield();
+      }
+    }
+
+    /**
+     * \b Requires: This must be called from an scheduled task.
+     *
+     * \b Effects: reschedule functions until pred()
+     */
+    template <typename Pred>
+    bool reschedule_until(Pred const& pred)
+    {
+      do {
+        if ( ! try_executing_one())
+        {
+          return false;
+        }
+      } while (! pred());
+      return true;
+    }
+  };
+}
+using executors::elastic_thread_pool;
+
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -89,7 +89,7 @@ namespace boost
     template <typename Closure>
     void submit(BOOST_THREAD_RV_REF(Closure) closure)
     {
-      work w = boost::move(closure);
+      work w ((boost::move(closure)));
       submit(boost::move(w));
     }
 
@@ -0,0 +1,478 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_INSTRUMENTED_EXECUTOR_HPP
+#define BOOST_THREAD_EXECUTORS_INSTRUMENTED_EXECUTOR_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/thread_only.hpp>
+#include <boost/thread/executors/work.hpp>
+#include <boost/chrono/system_clocks.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/type_traits/decay.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace executors
+{
+  /**
+   * A histogram of durations in nanoseconds with log-linear buckets, as HDR histograms: the values below 8 have their
+   * own bucket, and each power of two above is split in 8 buckets, so that a value is known within 12.5%.
+   */
+  struct executor_histogram
+  {
+    /// the number of sub-buckets of each power of two, and its log2.
+    BOOST_STATIC_CONSTEXPR unsigned sub_bucket_bits = 3;
+    BOOST_STATIC_CONSTEXPR unsigned sub_buckets = 1u << sub_bucket_bits;
+    BOOST_STATIC_CONSTEXPR unsigned buckets = (64 - sub_bucket_bits + 1) * sub_buckets;
+
+    boost::uint64_t counts[buckets];
+
+    executor_histogram()
+    {
+      for (unsigned i = 0; i < buckets; ++i) counts[i] = 0;
+    }
+
+    /**
+     * \b Returns: the index of the bucket of \c value.
+     */
+    static unsigned bucket_of(boost::uint64_t value) BOOST_NOEXCEPT
+    {
+      if (value < sub_buckets)
+      {
+        return unsigned(value);
+      }
+      unsigned log2 = 0;
+      for (unsigned shift = 32; shift > 0; shift /= 2)
+      {
+        if (value >> (log2 + shift)) log2 += shift;
+      }
+      unsigned const shift = log2 - sub_bucket_bits;
+      return (shift + 1) * sub_buckets + unsigned((value >> shift) & (sub_buckets - 1));
+    }
+
+    /**
+     * \b Returns: the lowest value of the bucket \c bucket.
+     */
+    static boost::uint64_t bucket_lower(unsigned bucket) BOOST_NOEXCEPT
+    {
+      if (bucket < sub_buckets)
+      {
+        return bucket;
+      }
+      unsigned const shift = bucket / sub_buckets - 1;
+      return boost::uint64_t(sub_buckets + bucket % sub_buckets) << shift;
+    }
+
+    /**
+     * \b Returns: the highest value of the bucket \c bucket.
+     */
+    static boost::uint64_t bucket_upper(unsigned bucket) BOOST_NOEXCEPT
+    {
+      return bucket + 1 < buckets ? bucket_lower(bucket + 1) - 1 : ~boost::uint64_t(0);
+    }
+
+    /**
+     * \b Returns: the number of recorded values.
+     */
+    boost::uint64_t count() const BOOST_NOEXCEPT
+    {
+      boost::uint64_t n = 0;
+      for (unsigned i = 0; i < buckets; ++i) n += counts[i];
+      return n;
+    }
+
+    /**
+     * \b Returns: the highest value of the bucket holding the \c p percentile, \c p in [0, 100], or 0 if there is
+     * no recorded value.
+     */
+    boost::uint64_t percentile(double p) const BOOST_NOEXCEPT
+    {
+      boost::uint64_t const n = count();
+      if (n == 0)
+      {
+        return 0;
+      }
+      boost::uint64_t rank = boost::uint64_t(p / 100 * double(n) + 0.5);
+      if (rank == 0) rank = 1;
+      boost::uint64_t seen = 0;
+      for (unsigned i = 0; i < buckets; ++i)
+      {
+        seen += counts[i];
+        if (seen >= rank) return bucket_upper(i);
+      }
+      return bucket_upper(buckets - 1);
+    }
+  };
+
+  /**
+   * A snapshot of the counters and histograms of an \c instrumented_executor.
+   */
+  struct executor_stats
+  {
+    /// the closures accepted by the underlying executor, refused by it, started, and finished, normally or by an
+    /// exception.
+    boost::uint64_t submitted;
+    boost::uint64_t rejected;
+    boost::uint64_t started;
+    boost::uint64_t completed;
+    boost::uint64_t failed;
+    /// the time spent running closures, summed over all the threads.
+    chrono::nanoseconds busy_time;
+    /// the time since the executor was instrumented.
+    chrono::nanoseconds elapsed;
+    /// the time from submission to start, and from start to completion, in nanoseconds.
+    executor_histogram wait_time;
+    executor_histogram run_time;
+
+    executor_stats()
+    : submitted(0), rejected(0), started(0), completed(0), failed(0), busy_time(0), elapsed(0)
+    {
+    }
+
+    /**
+     * \b Returns: the number of closures submitted and not started yet.
+     */
+    boost::uint64_t queued() const
+    {
+      return submitted > started ? submitted - started : 0;
+    }
+
+    /**
+     * \b Returns: the number of closures being run.
+     */
+    boost::uint64_t running() const
+    {
+      return started > completed ? started - completed : 0;
+    }
+
+    /**
+     * \b Returns: the number of completed closures per second.
+     */
+    double throughput() const
+    {
+      return elapsed.count() > 0 ? double(completed) * 1e9 / double(elapsed.count()) : 0;
+    }
+
+    /**
+     * \b Returns: the ratio of the time spent running closures to the elapsed time, for \c threads threads.
+     */
+    double utilization(unsigned threads) const
+    {
+      return elapsed.count() > 0 && threads > 0 ? double(busy_time.count()) / double(elapsed.count()) / threads : 0;
+    }
+  };
+
+  /**
+   * An executor adaptor recording, for the closures submitted through it, the time they wait for a thread and the
+   * time they run, as histograms, and counting them.
+   *
+   * The recording threads update their own shard of counters, selected by a hash of their id, with relaxed atomic
+   * operations, so that no lock is taken. \c stats() sums the shards. When disabled, the closures are submitted
+   * as is and the cost is a single relaxed load.
+   */
+  template <class Executor>
+  class instrumented_executor
+  {
+  public:
+    /// type-erasure to store the works to do
+    typedef  executors::work work;
+    typedef chrono::steady_clock clock;
+  private:
+    typedef boost::uint64_t counter_type;
+
+    /// the counters updated by the threads whose id hash to it, padded to its own cache lines.
+    struct shard
+    {
+      atomic<counter_type> submitted;
+      atomic<counter_type> rejected;
+      atomic<counter_type> started;
+      atomic<counter_type> completed;
+      atomic<counter_type> failed;
+      atomic<counter_type> busy_ns;
+      atomic<counter_type> wait_time[executor_histogram::buckets];
+      atomic<counter_type> run_time[executor_histogram::buckets];
+      char pad[64];
+
+      shard() : submitted(0), rejected(0), started(0), completed(0), failed(0), busy_ns(0)
+      {
+        for (unsigned i = 0; i < executor_histogram::buckets; ++i)
+        {
+          wait_time[i].store(0, memory_order_relaxed);
+          run_time[i].store(0, memory_order_relaxed);
+        }
+      }
+    };
+
+    Executor& ex;
+    atomic<bool> enabled_;
+    clock::time_point const start_;
+    unsigned const shard_count_;
+    scoped_array<shard> shards_;
+
+    static void add(atomic<counter_type>& c, counter_type n = 1)
+    {
+      c.fetch_add(n, memory_order_relaxed);
+    }
+
+    static counter_type nanoseconds(clock::duration d)
+    {
+      return d.count() > 0 ? counter_type(chrono::duration_cast<chrono::nanoseconds>(d).count()) : 0;
+    }
+
+    shard& local_shard()
+    {
+      // the thread ids are aligned addresses, mix their bits before reducing them to a shard.
+      boost::uint64_t const h = boost::uint64_t(boost::hash<thread::id>()(this_thread::get_id())) * UINT64_C(0x9E3779B97F4A7C15);
+      return shards_[unsigned(h >> 32) % shard_count_];
+    }
+
+    /// the closure submitted to the underlying executor: records the wait and run time of \c f.
+    template <class Closure>
+    struct timed
+    {
+      instrumented_executor* self_;
+      clock::time_point submitted_;
+      mutable Closure f_;
+
+      timed(instrumented_executor& self, Closure const& f)
+      : self_(&self), submitted_(clock::now()), f_(f)
+      {
+      }
+#if ! defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+      timed(instrumented_executor& self, Closure&& f)
+      : self_(&self), submitted_(clock::now()), f_(boost::move(f))
+      {
+      }
+#endif
+
+      void operator()() const
+      {
+        clock::time_point const started = clock::now();
+        shard& s = self_->local_shard();
+        add(s.started);
+        add(s.wait_time[executor_histogram::bucket_of(nanoseconds(started - submitted_))]);
+        try
+        {
+          f_();
+        }
+        catch (...)
+        {
+          self_->finished(s, started, true);
+          throw;
+        }
+        self_->finished(s, started, false);
+      }
+    };
+
+    void finished(shard& s, clock::time_point started, bool failed)
+    {
+      counter_type const ns = nanoseconds(clock::now() - started);
+      add(s.run_time[executor_histogram::bucket_of(ns)]);
+      add(s.busy_ns, ns);
+      if (failed) add(s.failed);
+      // released, so that the recording happens before the completion is seen by stats().
+      s.completed.fetch_add(1, memory_order_release);
+    }
+
+    template <class Closure>
+    void submit_timed(Closure& closure)
+    {
+      shard& s = local_shard();
+      // counted before the submission, so that started never exceeds submitted.
+      add(s.submitted);
+      try
+      {
+        ex.submit(boost::move(closure));
+      }
+      catch (...)
+      {
+        s.submitted.fetch_sub(1, memory_order_relaxed);
+        add(s.rejected);
+        throw;
+      }
+    }
+
+  public:
+    /// instrumented_executor is not copyable.
+    BOOST_THREAD_NO_COPYABLE(instrumented_executor)
+
+    /**
+     * \b Effects: creates an enabled instrumented executor that submits closures to the underlying executor \c ex.
+     *
+     * \b Throws: Whatever exception is thrown while allocating the shards.
+     */
+    instrumented_executor(Executor& ex)
+    : ex(ex), enabled_(true), start_(clock::now()),
+      shard_count_(thread::hardware_concurrency() ? thread::hardware_concurrency() : 1),
+      shards_(new shard[shard_count_])
+    {
+    }
+
+    /**
+     * \b Effects: Destroys the instrumented executor.
+     *
+     * \b Requires: The closures submitted through it have been executed, or discarded.
+     */
+    ~instrumented_executor()
+    {
+    }
+
+    /**
+     * \b Returns: the underlying executor.
+     */
+    Executor& underlying_executor()
+    {
+      return ex;
+    }
+
+    /**
+     * \b Effects: Whether the closures submitted from now on are recorded. The ones already submitted are recorded
+     * as they were when submitted.
+     */
+    void enable(bool enabled)
+    {
+      enabled_.store(enabled, memory_order_relaxed);
+    }
+
+    /**
+     * \b Returns: whether the closures submitted are recorded.
+     */
+    bool enabled() const
+    {
+      return enabled_.load(memory_order_relaxed);
+    }
+
+    /**
+     * \b Returns: the sum of the counters and histograms of all the threads. The shards are read while the
+     * threads update them, so the counters may not be consistent with each other by a few closures.
+     */
+    executor_stats stats() const
+    {
+      executor_stats r;
+      counter_type busy = 0;
+      for (unsigned i = 0; i < shard_count_; ++i)
+      {
+        shard const& s = shards_[i];
+        r.completed += s.completed.load(memory_order_acquire);
+        r.failed += s.failed.load(memory_order_relaxed);
+        busy += s.busy_ns.load(memory_order_relaxed);
+        r.started += s.started.load(memory_order_relaxed);
+        r.submitted += s.submitted.load(memory_order_relaxed);
+        r.rejected += s.rejected.load(memory_order_relaxed);
+        for (unsigned b = 0; b < executor_histogram::buckets; ++b)
+        {
+          r.wait_time.counts[b] += s.wait_time[b].load(memory_order_relaxed);
+          r.run_time.counts[b] += s.run_time[b].load(memory_order_relaxed);
+        }
+      }
+      r.busy_time = chrono::nanoseconds(busy);
+      r.elapsed = chrono::duration_cast<chrono::nanoseconds>(clock::now() - start_);
+      return r;
+    }
+
+    /**
+     * \b Effects: As the underlying executor close().
+     */
+    void close()
+    {
+      ex.close();
+    }
+
+    /**
+     * \b Returns: whether the underlying executor is closed for submissions.
+     */
+    bool closed()
+    {
+      return ex.closed();
+    }
+
+    /**
+     * \b Requires: \c Closure is a model of \c Callable(void()) and a model of \c CopyConstructible/MoveConstructible.
+     *
+     * \b Effects: Submits \c closure to the underlying executor, recording its wait and run time if the executor is
+     * enabled.
+     *
+     * \b Throws: Whatever the underlying executor submit throws, the closure being counted as rejected.
+     */
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit(Closure & closure)
+    {
+      if (! enabled())
+      {
+        ex.submit(closure);
+        return;
+      }
+      timed<Closure> t(*this, closure);
+      submit_timed(t);
+    }
+#endif
+    void submit(void (*closure)())
+    {
+      if (! enabled())
+      {
+        ex.submit(closure);
+        return;
+      }
+      timed<void (*)()> t(*this, closure);
+      submit_timed(t);
+    }
+
+    template <typename Closure>
+    void submit(BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      if (! enabled())
+      {
+        ex.submit(boost::forward<Closure>(closure));
+        return;
+      }
+      timed<typename decay<Closure>::type> t(*this, boost::forward<Closure>(closure));
+      submit_timed(t);
+    }
+
+    /**
+     * \b Effects: As the underlying executor try_executing_one().
+     *
+     * \b Returns: whether a task has been executed.
+     */
+    bool try_executing_one()
+    {
+      return ex.try_executing_one();
+    }
+
+    /**
+     * \b Requires: This must be called from an scheduled task.
+     *
+     * \b Effects: reschedule functions until pred()
+     */
+    template <typename Pred>
+    bool reschedule_until(Pred const& pred)
+    {
+      do {
+        if ( ! try_executing_one())
+        {
+          return false;
+        }
+      } while (! pred());
+      return true;
+    }
+  };
+}
+using executors::executor_histogram;
+using executors::executor_stats;
+using executors::instrumented_executor;
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -189,10 +189,11 @@ namespace executors
      */
     void run_queued_closures()
     {
-      sync_queue<work>::underlying_queue_type q = work_queue.underlying_queue();
-      while (q.empty())
+      sync_queue<work>::underlying_queue_type q;
+      work_queue.underlying_queue().swap(q);
+      while (! q.empty())
       {
-        work task = q.front();
+        work task = boost::move(q.front());
         q.pop_front();
         task();
       }
@@ -0,0 +1,435 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_NUMA_THREAD_POOL_HPP
+#define BOOST_THREAD_EXECUTORS_NUMA_THREAD_POOL_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/scoped_thread.hpp>
+#include <boost/thread/sync_queue.hpp>
+#include <boost/thread/tss.hpp>
+#include <boost/thread/executors/work.hpp>
+#include <boost/thread/csbl/vector.hpp>
+#include <boost/thread/csbl/deque.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace executors
+{
+  /**
+   * A thread pool with a queue per NUMA node. The worker threads are spread over the nodes having cpus and pinned to
+   * the cpus of their node, when the platform supports it.
+   *
+   * A closure is pushed on the queue of the node the submitting thread runs on, so that it is run by a worker sharing
+   * the caches and the memory of the submitter. A worker runs the closures of its own node first and takes the
+   * closures of the other nodes only when its node has none.
+   */
+  class numa_thread_pool
+  {
+  public:
+    /// type-erasure to store the works to do
+    typedef  executors::work work;
+  private:
+    /// the kind of stored threads are scoped threads to ensure that the threads are joined.
+    /// A move aware vector type
+    typedef scoped_thread<> thread_t;
+    typedef csbl::vector<thread_t> thread_vector;
+
+    /// the queue and the parking lot of the workers of a NUMA node.
+    struct node_queue
+    {
+      mutex mtx;
+      csbl::deque<work> works;
+      /// the number of queued works, read without the mutex to skip the empty queues.
+      atomic<std::size_t> size;
+      mutex idle_mtx;
+      condition_variable idle_cv;
+      atomic<unsigned> idle_count;
+      node_queue() : size(0), idle_count(0) {}
+    };
+
+    /// the number of NUMA nodes, one queue each.
+    unsigned const nodes_;
+    scoped_array<node_queue> queues_;
+    /// the queue of the node of the current worker thread, if any.
+    thread_specific_ptr<node_queue> current_queue_;
+    /// the next queue used when the node of the submitting thread is unknown.
+    atomic<unsigned> next_;
+    /// whether the pool is closed for submissions
+    atomic<bool> closed_;
+    /// A move aware vector
+    thread_vector threads;
+
+    static void no_cleanup(node_queue*) {}
+
+    /**
+     * Effects: execute \c task, swallowing any exception it throws.
+     */
+    static void execute(work& task)
+    {
+      try
+      {
+        task();
+      }
+      catch (...)
+      {
+      }
+    }
+
+    /**
+     * \b Returns: the index of the queue of the node the current thread runs on.
+     */
+    unsigned local_node()
+    {
+      node_queue* self = current_queue_.get();
+      if (self)
+      {
+        return unsigned(self - queues_.get());
+      }
+      unsigned node = this_thread::get_numa_node();
+      return node < nodes_ ? node : next_.fetch_add(1, memory_order_relaxed) % nodes_;
+    }
+
+    bool pop(node_queue& q, work& task)
+    {
+      if (q.size.load(memory_order_relaxed) == 0)
+      {
+        return false;
+      }
+      lock_guard<mutex> lk(q.mtx);
+      if (q.works.empty())
+      {
+        return false;
+      }
+      task = boost::move(q.works.front());
+      q.works.pop_front();
+      q.size.fetch_sub(1, memory_order_relaxed);
+      return true;
+    }
+
+    /**
+     * Effects: look for a closure on the queue of the node \c first and then on the queues of the other nodes.
+     * Returns: whether a closure has been found.
+     */
+    bool find_work(unsigned first, work& task)
+    {
+      for (unsigned i = 0; i < nodes_; ++i)
+      {
+        if (pop(queues_[(first + i) % nodes_], task)) return true;
+      }
+      return false;
+    }
+
+    bool has_work()
+    {
+      for (unsigned i = 0; i < nodes_; ++i)
+      {
+        if (queues_[i].size.load(memory_order_relaxed) != 0) return true;
+      }
+      return false;
+    }
+
+    /**
+     * \b Returns: whether the pool is closed and all its queues empty. The queues are checked under their mutex, so
+     * that a closure pushed by a submission that didn't see the pool closed is not missed.
+     */
+    bool done()
+    {
+      if (! closed()) return false;
+      for (unsigned i = 0; i < nodes_; ++i)
+      {
+        lock_guard<mutex> lk(queues_[i].mtx);
+        if (! queues_[i].works.empty()) return false;
+      }
+      return true;
+    }
+
+    /**
+     * Effects: wakes up a parked worker of the node \c node or, if there is none, of another node.
+     */
+    void notify_idle(unsigned node)
+    {
+      atomic_thread_fence(memory_order_seq_cst);
+      for (unsigned i = 0; i < nodes_; ++i)
+      {
+        node_queue& q = queues_[(node + i) % nodes_];
+        if (q.idle_count.load(memory_order_relaxed) > 0)
+        {
+          {
+            lock_guard<mutex> lk(q.idle_mtx);
+          }
+          q.idle_cv.notify_one();
+          return;
+        }
+      }
+    }
+
+    /**
+     * Effects: block the current worker until there is some work to do or the pool is closed.
+     */
+    void park(node_queue& q)
+    {
+      unique_lock<mutex> lk(q.idle_mtx);
+      q.idle_count.fetch_add(1, memory_order_seq_cst);
+      atomic_thread_fence(memory_order_seq_cst);
+      if (! closed() && ! has_work())
+      {
+        q.idle_cv.wait(lk);
+      }
+      q.idle_count.fetch_sub(1, memory_order_relaxed);
+    }
+
+    /**
+     * The main loop of the worker threads of the node \c node: run the available closures, spin at most
+     * \c BOOST_THREAD_POOL_SPIN_COUNT times when there is none and then park.
+     * Returns once the pool is closed and there is no more closures to run.
+     */
+    void worker_thread(unsigned node)
+    {
+      current_queue_.reset(&queues_[node]);
+      unsigned spins = 0;
+      for (;;)
+      {
+        work task;
+        if (find_work(node, task))
+        {
+          spins = 0;
+          execute(task);
+        }
+        else if (done())
+        {
+          break;
+        }
+        else if (spins < BOOST_THREAD_POOL_SPIN_COUNT)
+        {
+          ++spins;
+          this_thread::yield();
+        }
+        else
+        {
+          spins = 0;
+          park(queues_[node]);
+        }
+      }
+    }
+
+    void push(unsigned node, work& w)
+    {
+      node_queue& q = queues_[node];
+      {
+        lock_guard<mutex> lk(q.mtx);
+        if (closed())
+        {
+          BOOST_THROW_EXCEPTION( sync_queue_is_closed() );
+        }
+        q.works.push_back(boost::move(w));
+        q.size.fetch_add(1, memory_order_relaxed);
+      }
+      notify_idle(node);
+    }
+
+  public:
+    /// numa_thread_pool is not copyable.
+    BOOST_THREAD_NO_COPYABLE(numa_thread_pool)
+
+    /**
+     * \b Effects: creates a thread pool that runs closures on \c thread_count threads, spread over the NUMA nodes
+     * having cpus and pinned to the cpus of their node.
+     *
+     * \b Throws: Whatever exception is thrown while initializing the needed resources.
+     */
+    numa_thread_pool(unsigned const thread_count = thread::hardware_concurrency())
+    : nodes_(thread::numa_node_count()), queues_(new node_queue[nodes_]), current_queue_(&no_cleanup),
+      next_(0), closed_(false)
+    {
+      try
+      {
+        csbl::vector<unsigned> nodes;
+        for (unsigned node = 0; node < nodes_; ++node)
+        {
+          if (! thread::numa_node_cpus(node).empty()) nodes.push_back(node);
+        }
+        if (nodes.empty()) nodes.push_back(0);
+        threads.reserve(thread_count);
+        for (unsigned i = 0; i < thread_count; ++i)
+        {
+          unsigned const node = nodes[i % nodes.size()];
+          thread::attributes attrs;
+          attrs.set_numa_node(node);
+          thread::attributes const& pinned = attrs;
+          thread th (pinned, boost::bind(&numa_thread_pool::worker_thread, this, node));
+          threads.push_back(thread_t(boost::move(th)));
+        }
+      }
+      catch (...)
+      {
+        close();
+        throw;
+      }
+    }
+
+    /**
+     * \b Effects: Destroys the thread pool.
+     *
+     * \b Synchronization: The completion of all the closures happen before the completion of the \c numa_thread_pool destructor.
+     */
+    ~numa_thread_pool()
+    {
+      // signal to all the worker threads that there will be no more submissions.
+      close();
+      // joins all the threads as the threads were scoped_threads
+    }
+
+    /**
+     * \b Returns: the number of NUMA nodes, and so of queues.
+     */
+    unsigned nodes() const
+    {
+      return nodes_;
+    }
+
+    /**
+     * \b Effects: close the \c numa_thread_pool for submissions.
+     * The worker threads will work until there is no more closures to run.
+     */
+    void close()
+    {
+      closed_.store(true);
+      for (unsigned i = 0; i < nodes_; ++i)
+      {
+        {
+          lock_guard<mutex> lk(queues_[i].idle_mtx);
+        }
+        queues_[i].idle_cv.notify_all();
+      }
+    }
+
+    /**
+     * \b Returns: whether the pool is closed for submissions.
+     */
+    bool closed()
+    {
+      return closed_.load();
+    }
+
+    /**
+     * \b Requires: \c Closure is a model of \c Callable(void()) and a model of \c CopyConstructible/MoveConstructible.
+     *
+     * \b Effects: The specified \c closure will be scheduled for execution on the queue of the NUMA node the calling
+     * thread runs on, or of the node of the calling worker thread of the pool.
+     * If invoked closure throws an exception the \c numa_thread_pool will call \c std::terminate, as is the case with threads.
+     *
+     * \b Synchronization: completion of \c closure on a particular thread happens before destruction of thread's thread local variables.
+     *
+     * \b Throws: \c sync_queue_is_closed if the thread pool is closed.
+     * Whatever exception that can be throw while storing the closure.
+     */
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit(Closure & closure)
+    {
+      work w((closure));
+      push(local_node(), w);
+    }
+#endif
+    void submit(void (*closure)())
+    {
+      work w((closure));
+      push(local_node(), w);
+    }
+
+    template <typename Closure>
+    void submit(BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w((boost::forward<Closure>(closure)));
+      push(local_node(), w);
+    }
+
+    /**
+     * \b Effects: As \c submit(), but on the queue of the NUMA node \c node, as when the data used by the closure has
+     * been allocated on this node. A \c node greater than <c>nodes()-1</c> is taken as the node of the calling thread.
+     */
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit_on_node(unsigned node, Closure & closure)
+    {
+      work w((closure));
+      push(node < nodes_ ? node : local_node(), w);
+    }
+#endif
+    void submit_on_node(unsigned node, void (*closure)())
+    {
+      work w((closure));
+      push(node < nodes_ ? node : local_node(), w);
+    }
+
+    template <typename Closure>
+    void submit_on_node(unsigned node, BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w((boost::forward<Closure>(closure)));
+      push(node < nodes_ ? node : local_node(), w);
+    }
+
+    /**
+     * \b Effects: try to execute one task, from the queue of the node of the calling thread first.
+     *
+     * \b Returns: whether a task has been executed.
+     */
+    bool try_executing_one()
+    {
+      work task;
+      if (find_work(local_node(), task))
+      {
+        execute(task);
+        return true;
+      }
+      return false;
+    }
+
+    /**
+     * \b Effects: schedule one task or yields
+     */
+    void schedule_one_or_yield()
+    {
+      if ( ! try_executing_one())
+      {
+        this_thread::yield();
+      }
+    }
+
+    /**
+     * \b Requires: This must be called from an scheduled task.
+     *
+     * \b Effects: reschedule functions until pred()
+     */
+    template <typename Pred>
+    bool reschedule_until(Pred const& pred)
+    {
+      do {
+        if ( ! try_executing_one())
+        {
+          return false;
+        }
+      } while (! pred());
+      return true;
+    }
+  };
+}
+using executors::numa_thread_pool;
+
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -0,0 +1,470 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_PRIORITY_THREAD_POOL_HPP
+#define BOOST_THREAD_EXECUTORS_PRIORITY_THREAD_POOL_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/scoped_thread.hpp>
+#include <boost/thread/sync_queue.hpp>
+#include <boost/thread/executors/work.hpp>
+#include <boost/thread/csbl/vector.hpp>
+#include <boost/thread/csbl/deque.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/chrono/system_clocks.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/atomic.hpp>
+
+#include <deque>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace executors
+{
+  /**
+   * A thread pool with a fixed number of threads and of priority levels, 0 being the most urgent one. Each level has
+   * its own queue and mutex, so that the submissions on different levels don't contend. An idle worker runs the
+   * oldest closure of the most urgent non-empty level.
+   *
+   * When an aging period is given, a closure that has waited longer than this period on a less urgent level is run
+   * before the more urgent ones, so that a steady flow of urgent closures can't starve the others.
+   */
+  class priority_thread_pool
+  {
+  public:
+    /// type-erasure to store the works to do
+    typedef  executors::work work;
+    /// the clock measuring how long the closures have waited.
+    typedef chrono::steady_clock clock;
+  private:
+    /// the kind of stored threads are scoped threads to ensure that the threads are joined.
+    /// A move aware vector type
+    typedef scoped_thread<> thread_t;
+    typedef csbl::vector<thread_t> thread_vector;
+
+    /// the queue of a priority level.
+    struct level
+    {
+      mutex mtx;
+      csbl::deque<work> works;
+      /// the submission times of the works, only kept when aging is enabled.
+      std::deque<clock::time_point> stamps;
+      /// the number of queued works, read without the mutex to skip the empty levels.
+      atomic<std::size_t> size;
+      level() : size(0) {}
+    };
+
+    /// the number of priority levels
+    unsigned const levels_;
+    scoped_array<level> queues_;
+    /// zero when aging is disabled.
+    clock::duration const aging_;
+    /// whether the pool is closed for submissions
+    atomic<bool> closed_;
+    /// parking lot of the idle worker threads
+    mutex idle_mtx_;
+    condition_variable idle_cv_;
+    atomic<unsigned> idle_count_;
+    /// A move aware vector
+    thread_vector threads;
+
+    /**
+     * Effects: execute \c task, swallowing any exception it throws.
+     */
+    static void execute(work& task)
+    {
+      try
+      {
+        task();
+      }
+      catch (...)
+      {
+      }
+    }
+
+    /**
+     * \b Effects: Pops the front closure of the level \c l into \c task if there is one and, when \c starving is
+     * given, only if it was submitted before \c starving.
+     *
+     * \b Returns: whether a closure has been popped.
+     */
+    bool pop(level& l, work& task, clock::time_point const* starving)
+    {
+      if (l.size.load(memory_order_relaxed) == 0)
+      {
+        return false;
+      }
+      lock_guard<mutex> lk(l.mtx);
+      if (l.works.empty() || (starving && ! (l.stamps.front() < *starving)))
+      {
+        return false;
+      }
+      task = boost::move(l.works.front());
+      l.works.pop_front();
+      if (aging_ != clock::duration::zero())
+      {
+        l.stamps.pop_front();
+      }
+      l.size.fetch_sub(1, memory_order_relaxed);
+      return true;
+    }
+
+    /**
+     * Effects: look for a starving closure, from the least urgent level, and then for the front closure of the
+     * most urgent non-empty level.
+     * Returns: whether a closure has been found.
+     */
+    bool find_work(work& task)
+    {
+      if (aging_ != clock::duration::zero())
+      {
+        clock::time_point starving = clock::now() - aging_;
+        for (unsigned i = levels_; i > 1; --i)
+        {
+          if (pop(queues_[i - 1], task, &starving)) return true;
+        }
+      }
+      for (unsigned i = 0; i < levels_; ++i)
+      {
+        if (pop(queues_[i], task, 0)) return true;
+      }
+      return false;
+    }
+
+    bool has_work()
+    {
+      for (unsigned i = 0; i < levels_; ++i)
+      {
+        if (queues_[i].size.load(memory_order_relaxed) != 0) return true;
+      }
+      return false;
+    }
+
+    /**
+     * \b Returns: whether the pool is closed and all its queues empty. The queues are checked under their mutex, so
+     * that a closure pushed by a submission that didn't see the pool closed is not missed.
+     */
+    bool done()
+    {
+      if (! closed()) return false;
+      for (unsigned i = 0; i < levels_; ++i)
+      {
+        lock_guard<mutex> lk(queues_[i].mtx);
+        if (! queues_[i].works.empty()) return false;
+      }
+      return true;
+    }
+
+    /**
+     * Effects: wakes up one parked worker if any.
+     */
+    void notify_idle()
+    {
+      atomic_thread_fence(memory_order_seq_cst);
+      if (idle_count_.load(memory_order_relaxed) > 0)
+      {
+        {
+          lock_guard<mutex> lk(idle_mtx_);
+        }
+        idle_cv_.notify_one();
+      }
+    }
+
+    /**
+     * Effects: block the current worker until there is some work to do or the pool is closed.
+     */
+    void park()
+    {
+      unique_lock<mutex> lk(idle_mtx_);
+      idle_count_.fetch_add(1, memory_order_seq_cst);
+      atomic_thread_fence(memory_order_seq_cst);
+      if (! closed() && ! has_work())
+      {
+        idle_cv_.wait(lk);
+      }
+      idle_count_.fetch_sub(1, memory_order_relaxed);
+    }
+
+    /**
+     * The main loop of the worker threads: run the available closures, spin at most
+     * \c BOOST_THREAD_POOL_SPIN_COUNT times when there is none and then park.
+     * Returns once the pool is closed and there is no more closures to run.
+     */
+    void worker_thread()
+    {
+      unsigned spins = 0;
+      for (;;)
+      {
+        work task;
+        if (find_work(task))
+        {
+          spins = 0;
+          execute(task);
+        }
+        else if (done())
+        {
+          break;
+        }
+        else if (spins < BOOST_THREAD_POOL_SPIN_COUNT)
+        {
+          ++spins;
+          this_thread::yield();
+        }
+        else
+        {
+          spins = 0;
+          park();
+        }
+      }
+    }
+
+    void start(unsigned const thread_count)
+    {
+      try
+      {
+        threads.reserve(thread_count);
+        for (unsigned i = 0; i < thread_count; ++i)
+        {
+          thread th (&priority_thread_pool::worker_thread, this);
+          threads.push_back(thread_t(boost::move(th)));
+        }
+      }
+      catch (...)
+      {
+        close();
+        throw;
+      }
+    }
+
+    void push(unsigned priority, work& w)
+    {
+      level& l = queues_[priority < levels_ ? priority : levels_ - 1];
+      {
+        lock_guard<mutex> lk(l.mtx);
+        if (closed())
+        {
+          BOOST_THROW_EXCEPTION( sync_queue_is_closed() );
+        }
+        if (aging_ != clock::duration::zero())
+        {
+          l.stamps.push_back(clock::now());
+          try
+          {
+            l.works.push_back(boost::move(w));
+          }
+          catch (...)
+          {
+            l.stamps.pop_back();
+            throw;
+          }
+        }
+        else
+        {
+          l.works.push_back(boost::move(w));
+        }
+        l.size.fetch_add(1, memory_order_relaxed);
+      }
+      notify_idle();
+    }
+
+  public:
+    /// priority_thread_pool is not copyable.
+    BOOST_THREAD_NO_COPYABLE(priority_thread_pool)
+
+    /**
+     * \b Requires: \c levels > 0.
+     *
+     * \b Effects: creates a thread pool that runs closures of \c levels priority levels on \c thread_count threads,
+     * without aging.
+     *
+     * \b Throws: Whatever exception is thrown while initializing the needed resources.
+     */
+    priority_thread_pool(unsigned const thread_count = thread::hardware_concurrency(), unsigned const levels = 3)
+    : levels_(levels), queues_(new level[levels]), aging_(clock::duration::zero()),
+      closed_(false), idle_count_(0)
+    {
+      start(thread_count);
+    }
+
+    /**
+     * \b Requires: \c levels > 0.
+     *
+     * \b Effects: creates a thread pool that runs closures of \c levels priority levels on \c thread_count threads,
+     * running first the closures that have waited longer than \c aging on a less urgent level.
+     *
+     * \b Throws: Whatever exception is thrown while initializing the needed resources.
+     */
+    template <class Rep, class Period>
+    priority_thread_pool(unsigned const thread_count, unsigned const levels, chrono::duration<Rep, Period> const& aging)
+    : levels_(levels), queues_(new level[levels]), aging_(chrono::duration_cast<clock::duration>(aging)),
+      closed_(false), idle_count_(0)
+    {
+      start(thread_count);
+    }
+
+    /**
+     * \b Effects: Destroys the thread pool.
+     *
+     * \b Synchronization: The completion of all the closures happen before the completion of the \c priority_thread_pool destructor.
+     */
+    ~priority_thread_pool()
+    {
+      // signal to all the worker threads that there will be no more submissions.
+      close();
+      // joins all the threads as the threads were scoped_threads
+    }
+
+    /**
+     * \b Returns: the number of priority levels.
+     */
+    unsigned levels() const
+    {
+      return levels_;
+    }
+
+    /**
+     * \b Returns: the priority of the closures submitted without priority, the middle level.
+     */
+    unsigned default_priority() const
+    {
+      return levels_ / 2;
+    }
+
+    /**
+     * \b Effects: close the \c priority_thread_pool for submissions.
+     * The worker threads will work until there is no more closures to run.
+     */
+    void close()
+    {
+      closed_.store(true);
+      {
+        lock_guard<mutex> lk(idle_mtx_);
+      }
+      idle_cv_.notify_all();
+    }
+
+    /**
+     * \b Returns: whether the pool is closed for submissions.
+     */
+    bool closed()
+    {
+      return closed_.load();
+    }
+
+    /**
+     * \b Requires: \c Closure is a model of \c Callable(void()) and a model of \c CopyConstructible/MoveConstructible.
+     *
+     * \b Effects: The specified \c closure will be scheduled for execution after the closures of the more urgent levels,
+     * and after the closures of the same level submitted before it. A \c priority greater than <c>levels()-1</c> is taken
+     * as the least urgent level.
+     * If invoked closure throws an exception the \c priority_thread_pool will call \c std::terminate, as is the case with threads.
+     *
+     * \b Synchronization: completion of \c closure on a particular thread happens before destruction of thread's thread local variables.
+     *
+     * \b Throws: \c sync_queue_is_closed if the thread pool is closed.
+     * Whatever exception that can be throw while storing the closure.
+     */
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit(unsigned priority, Closure & closure)
+    {
+      work w((closure));
+      push(priority, w);
+    }
+#endif
+    void submit(unsigned priority, void (*closure)())
+    {
+      work w((closure));
+      push(priority, w);
+    }
+
+    template <typename Closure>
+    void submit(unsigned priority, BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w((boost::forward<Closure>(closure)));
+      push(priority, w);
+    }
+
+    /**
+     * \b Effects: Submits \c closure with the default priority, so that the pool models the \c Executor concept.
+     */
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit(Closure & closure)
+    {
+      work w((closure));
+      push(default_priority(), w);
+    }
+#endif
+    void submit(void (*closure)())
+    {
+      work w((closure));
+      push(default_priority(), w);
+    }
+
+    template <typename Closure>
+    void submit(BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w((boost::forward<Closure>(closure)));
+      push(default_priority(), w);
+    }
+
+    /**
+     * \b Effects: try to execute one task.
+     *
+     * \b Returns: whether a task has been executed.
+     */
+    bool try_executing_one()
+    {
+      work task;
+      if (find_work(task))
+      {
+        execute(task);
+        return true;
+      }
+      return false;
+    }
+
+    /**
+     * \b Effects: schedule one task or yields
+     */
+    void schedule_one_or_yield()
+    {
+      if ( ! try_executing_one())
+      {
+        this_thread::yield();
+      }
+    }
+
+    /**
+     * \b Requires: This must be called from an scheduled task.
+     *
+     * \b Effects: reschedule functions until pred()
+     */
+    template <typename Pred>
+    bool reschedule_until(Pred const& pred)
+    {
+      do {
+        if ( ! try_executing_one())
+        {
+          return false;
+        }
+      } while (! pred());
+      return true;
+    }
+  };
+}
+using executors::priority_thread_pool;
+
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -0,0 +1,187 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_SCHEDULED_THREAD_POOL_HPP
+#define BOOST_THREAD_EXECUTORS_SCHEDULED_THREAD_POOL_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/executors/scheduling_adaptor.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace executors
+{
+  /**
+   * A basic_thread_pool whose closures can also be scheduled at a given time, through a scheduling_adaptor.
+   */
+  class scheduled_thread_pool
+  {
+  public:
+    /// type-erasure to store the works to do
+    typedef  executors::work work;
+    typedef scheduling_adaptor<basic_thread_pool>::clock clock;
+  private:
+    /// Declared before the adaptor, whose timer thread submits to it until it is joined.
+    basic_thread_pool pool_;
+    scheduling_adaptor<basic_thread_pool> scheduler_;
+
+    void throw_if_closed()
+    {
+      if (scheduler_.closed())
+      {
+        BOOST_THROW_EXCEPTION( sync_queue_is_closed() );
+      }
+    }
+
+  public:
+    /// scheduled_thread_pool is not copyable.
+    BOOST_THREAD_NO_COPYABLE(scheduled_thread_pool)
+
+    /**
+     * \b Effects: creates a thread pool that runs closures on \c thread_count threads, and its timer thread.
+     *
+     * \b Throws: Whatever exception is thrown while initializing the needed resources.
+     */
+    scheduled_thread_pool(unsigned const thread_count = thread::hardware_concurrency())
+    : pool_(thread_count), scheduler_(pool_)
+    {
+    }
+
+    /**
+     * \b Effects: Destroys the thread pool, discarding the closures that are not due yet.
+     *
+     * \b Synchronization: The completion of all the closures submitted to the pool happen before the completion of the
+     * destructor.
+     */
+    ~scheduled_thread_pool()
+    {
+    }
+
+    /**
+     * \b Effects: close the pool for submissions. The closures already scheduled are still run when they are due, and
+     * the worker threads work until there is no more closures to run. The underlying pool stays open for the timer
+     * thread until the destructor, which closes it once the timer thread has been joined.
+     */
+    void close()
+    {
+      scheduler_.close();
+    }
+
+    /**
+     * \b Returns: whether the pool is closed for submissions.
+     */
+    bool closed()
+    {
+      return scheduler_.closed();
+    }
+
+    /**
+     * \b Returns: the number of closures scheduled and not yet due.
+     */
+    std::size_t pending()
+    {
+      return scheduler_.pending();
+    }
+
+    /**
+     * \b Effects: As \c basic_thread_pool::submit().
+     */
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit(Closure & closure)
+    {
+      throw_if_closed();
+      pool_.submit(closure);
+    }
+#endif
+    void submit(void (*closure)())
+    {
+      throw_if_closed();
+      pool_.submit(closure);
+    }
+
+    template <typename Closure>
+    void submit(BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      throw_if_closed();
+      pool_.submit(boost::forward<Closure>(closure));
+    }
+
+    /**
+     * \b Effects: As \c scheduling_adaptor::submit_after().
+     */
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <class Rep, class Period, typename Closure>
+    void submit_after(chrono::duration<Rep, Period> const& rel_time, Closure & closure)
+    {
+      scheduler_.submit_after(rel_time, closure);
+    }
+#endif
+    template <class Rep, class Period>
+    void submit_after(chrono::duration<Rep, Period> const& rel_time, void (*closure)())
+    {
+      scheduler_.submit_after(rel_time, closure);
+    }
+
+    template <class Rep, class Period, typename Closure>
+    void submit_after(chrono::duration<Rep, Period> const& rel_time, BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      scheduler_.submit_after(rel_time, boost::forward<Closure>(closure));
+    }
+
+    /**
+     * \b Effects: As \c scheduling_adaptor::submit_at().
+     */
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <class Clock, class Duration, typename Closure>
+    void submit_at(chrono::time_point<Clock, Duration> const& abs_time, Closure & closure)
+    {
+      scheduler_.submit_at(abs_time, closure);
+    }
+#endif
+    template <class Clock, class Duration>
+    void submit_at(chrono::time_point<Clock, Duration> const& abs_time, void (*closure)())
+    {
+      scheduler_.submit_at(abs_time, closure);
+    }
+
+    template <class Clock, class Duration, typename Closure>
+    void submit_at(chrono::time_point<Clock, Duration> const& abs_time, BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      scheduler_.submit_at(abs_time, boost::forward<Closure>(closure));
+    }
+
+    /**
+     * Effects: try to execute one task.
+     * Returns: whether a task has been executed.
+     */
+    bool try_executing_one()
+    {
+      return pool_.try_executing_one();
+    }
+
+    /**
+     * \b Requires: This must be called from an scheduled task.
+     *
+     * \b Effects: reschedule functions until pred()
+     */
+    template <typename Pred>
+    bool reschedule_until(Pred const& pred)
+    {
+      return pool_.reschedule_until(pred);
+    }
+  };
+}
+using executors::scheduled_thread_pool;
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -0,0 +1,400 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_SCHEDULING_ADAPTOR_HPP
+#define BOOST_THREAD_EXECUTORS_SCHEDULING_ADAPTOR_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/executors/work.hpp>
+#include <boost/thread/sync_queue.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/thread_only.hpp>
+#include <boost/thread/csbl/vector.hpp>
+#include <boost/chrono/system_clocks.hpp>
+#include <boost/chrono/ceil.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace executors
+{
+  /**
+   * An executor adaptor that, in addition to submitting closures to the underlying executor at once, runs closures at
+   * a given time. The scheduled closures are kept in a binary heap ordered by their due time on the steady clock and a
+   * single timer thread sleeps until the earliest one is due, and then hands all the due closures to the underlying
+   * executor. Scheduling a closure is logarithmic in the number of pending ones and doesn't allocate once the heap has
+   * grown, so that many pending timeouts are cheap.
+   */
+  template <class Executor>
+  class scheduling_adaptor
+  {
+  public:
+    /// type-erasure to store the works to do
+    typedef  executors::work work;
+    /// the clock on which the closures are scheduled. The time points of other clocks are converted to this one.
+    typedef chrono::steady_clock clock;
+  private:
+    /// an element of the heap: the closure is kept apart in works_, so that the heap elements are cheap to move.
+    struct timer
+    {
+      clock::time_point due;
+      /// breaks the ties so that the closures due at the same time are run in submission order.
+      boost::uintmax_t seq;
+      std::size_t slot;
+      timer(clock::time_point due, boost::uintmax_t seq, std::size_t slot) : due(due), seq(seq), slot(slot) {}
+    };
+    /// the order of a min-heap on (due, seq).
+    struct later
+    {
+      bool operator()(timer const& x, timer const& y) const
+      {
+        return y.due < x.due || (! (x.due < y.due) && y.seq < x.seq);
+      }
+    };
+
+    Executor& ex;
+    mutex mtx_;
+    /// notified when an earlier closure is scheduled or the adaptor is closed or destroyed.
+    condition_variable cv_;
+    std::vector<timer> heap_;
+    /// the scheduled closures, indexed by the slot of their timer, and the slots that are free.
+    csbl::vector<work> works_;
+    std::vector<std::size_t> free_slots_;
+    boost::uintmax_t seq_;
+    bool closed_;
+    bool destroyed_;
+    /// the due closures taken from the heap, only used by the timer thread.
+    csbl::vector<work> due_;
+    /// Declared last, as it uses all the members above.
+    thread timer_thread_;
+
+    /**
+     * \b Effects: Schedules \c w to be submitted to the underlying executor at \c due, waking up the timer thread if
+     * it becomes the earliest closure.
+     *
+     * \b Throws: \c sync_queue_is_closed if the adaptor is closed. Whatever exception is thrown while storing the closure.
+     */
+    void schedule(clock::time_point due, BOOST_THREAD_RV_REF(work) w)
+    {
+      lock_guard<mutex> lk(mtx_);
+      if (closed_) throw_exception(sync_queue_is_closed());
+      std::size_t slot;
+      if (free_slots_.empty())
+      {
+        slot = works_.size();
+        works_.push_back(boost::move(w));
+      }
+      else
+      {
+        slot = free_slots_.back();
+        works_[slot] = boost::move(w);
+        free_slots_.pop_back();
+      }
+      try
+      {
+        heap_.push_back(timer(due, seq_++, slot));
+      }
+      catch (...)
+      {
+        works_[slot] = work();
+        free_slots_.push_back(slot);
+        throw;
+      }
+      std::push_heap(heap_.begin(), heap_.end(), later());
+      if (heap_.front().slot == slot)
+      {
+        cv_.notify_one();
+      }
+    }
+
+    /**
+     * \b Effects: Moves the closures due at \c now from the heap to \c due_.
+     */
+    void take_due(clock::time_point now)
+    {
+      while (! heap_.empty() && ! (now < heap_.front().due))
+      {
+        std::pop_heap(heap_.begin(), heap_.end(), later());
+        std::size_t slot = heap_.back().slot;
+        heap_.pop_back();
+        due_.push_back(boost::move(works_[slot]));
+        free_slots_.push_back(slot);
+      }
+    }
+
+    /**
+     * \b Effects: Submits the due closures to the underlying executor. If it doesn't accept them, as when it is
+     * closed, they are executed by the timer thread rather than lost, ignoring the exceptions they throw.
+     */
+    void submit_due()
+    {
+      for (typename csbl::vector<work>::iterator it = due_.begin(); it != due_.end(); ++it)
+      {
+        // the executors take the closure before refusing it, so it is run here when the executor is known to refuse it.
+        if (! ex.closed())
+        {
+          try
+          {
+            ex.submit(boost::move(*it));
+            continue;
+          }
+          catch (...)
+          {
+          }
+        }
+        if (! it->empty())
+        {
+          try
+          {
+            (*it)();
+          }
+          catch (...)
+          {
+          }
+        }
+      }
+      due_.clear();
+    }
+
+    /**
+     * The main loop of the timer thread: sleeps until the earliest closure is due and hands the due closures to the
+     * underlying executor. Returns once the adaptor is closed and no closure is pending, or when it is destroyed.
+     */
+    void run_timers()
+    {
+      unique_lock<mutex> lk(mtx_);
+      for (;;)
+      {
+        if (destroyed_ || (closed_ && heap_.empty()))
+        {
+          return;
+        }
+        if (heap_.empty())
+        {
+          cv_.wait(lk);
+          continue;
+        }
+        clock::time_point now = clock::now();
+        if (now < heap_.front().due)
+        {
+          // copied, as the heap can be reallocated while waiting
+          clock::time_point due = heap_.front().due;
+          cv_.wait_until(lk, due);
+          continue;
+        }
+        take_due(now);
+        lk.unlock();
+        submit_due();
+        lk.lock();
+      }
+    }
+
+  public:
+    /// scheduling_adaptor is not copyable.
+    BOOST_THREAD_NO_COPYABLE(scheduling_adaptor)
+
+    /**
+     * \b Effects: creates an adaptor scheduling the closures on the underlying executor \c ex and starts its timer thread.
+     *
+     * \b Throws: Whatever exception is thrown while creating the timer thread.
+     */
+    scheduling_adaptor(Executor& ex)
+    : ex(ex), seq_(0), closed_(false), destroyed_(false)
+    {
+      thread th(&scheduling_adaptor::run_timers, this);
+      timer_thread_ = boost::move(th);
+    }
+
+    /**
+     * \b Effects: Discards the closures that are not due yet and waits for the timer thread, which may be
+     * handing the due ones to the underlying executor.
+     *
+     * \b Synchronization: The submission of the due closures to the underlying executor happens before the completion
+     * of the destructor.
+     */
+    ~scheduling_adaptor()
+    {
+      {
+        lock_guard<mutex> lk(mtx_);
+        closed_ = true;
+        destroyed_ = true;
+        cv_.notify_all();
+      }
+      timer_thread_.join();
+    }
+
+    /**
+     * \b Returns: the underlying executor.
+     */
+    Executor& underlying_executor()
+    {
+      return ex;
+    }
+
+    /**
+     * \b Effects: close the \c scheduling_adaptor for submissions. The closures already scheduled are still handed to
+     * the underlying executor when they are due. The underlying executor is not closed.
+     */
+    void close()
+    {
+      lock_guard<mutex> lk(mtx_);
+      closed_ = true;
+      cv_.notify_all();
+    }
+
+    /**
+     * \b Returns: whether the adaptor is closed for submissions.
+     */
+    bool closed()
+    {
+      lock_guard<mutex> lk(mtx_);
+      return closed_;
+    }
+
+    /**
+     * \b Returns: the number of closures scheduled and not yet due.
+     */
+    std::size_t pending()
+    {
+      lock_guard<mutex> lk(mtx_);
+      return heap_.size();
+    }
+
+    /**
+     * \b Requires: \c Closure is a model of \c Callable(void()) and a model of \c CopyConstructible/MoveConstructible.
+     *
+     * \b Effects: Submits the closure to the underlying executor at once.
+     *
+     * \b Throws: Whatever the underlying executor submit throws.
+     */
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit(Closure & closure)
+    {
+      ex.submit(closure);
+    }
+#endif
+    void submit(void (*closure)())
+    {
+      ex.submit(closure);
+    }
+
+    template <typename Closure>
+    void submit(BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      ex.submit(boost::forward<Closure>(closure));
+    }
+
+    /**
+     * \b Requires: \c Closure is a model of \c Callable(void()) and a model of \c CopyConstructible/MoveConstructible.
+     *
+     * \b Effects: The closure will be submitted to the underlying executor once \c rel_time has elapsed. The closures
+     * due at the same time are submitted in the order they were scheduled.
+     *
+     * \b Throws: \c sync_queue_is_closed if the adaptor is closed.
+     * Whatever exception that can be throw while storing the closure.
+     */
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <class Rep, class Period, typename Closure>
+    void submit_after(chrono::duration<Rep, Period> const& rel_time, Closure & closure)
+    {
+      work w ((closure));
+      schedule(clock::now() + chrono::ceil<clock::duration>(rel_time), boost::move(w));
+    }
+#endif
+    template <class Rep, class Period>
+    void submit_after(chrono::duration<Rep, Period> const& rel_time, void (*closure)())
+    {
+      work w ((closure));
+      schedule(clock::now() + chrono::ceil<clock::duration>(rel_time), boost::move(w));
+    }
+
+    template <class Rep, class Period, typename Closure>
+    void submit_after(chrono::duration<Rep, Period> const& rel_time, BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w ((boost::forward<Closure>(closure)));
+      schedule(clock::now() + chrono::ceil<clock::duration>(rel_time), boost::move(w));
+    }
+
+    /**
+     * \b Requires: \c Closure is a model of \c Callable(void()) and a model of \c CopyConstructible/MoveConstructible.
+     *
+     * \b Effects: The closure will be submitted to the underlying executor once \c abs_time is reached. If \c Clock is
+     * not the steady clock, \c abs_time is converted to the steady clock when the closure is scheduled, so that later
+     * adjustments of \c Clock are not taken into account.
+     *
+     * \b Throws: \c sync_queue_is_closed if the adaptor is closed.
+     * Whatever exception that can be throw while storing the closure.
+     */
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <class Clock, class Duration, typename Closure>
+    void submit_at(chrono::time_point<Clock, Duration> const& abs_time, Closure & closure)
+    {
+      work w ((closure));
+      schedule(to_steady(abs_time), boost::move(w));
+    }
+#endif
+    template <class Clock, class Duration>
+    void submit_at(chrono::time_point<Clock, Duration> const& abs_time, void (*closure)())
+    {
+      work w ((closure));
+      schedule(to_steady(abs_time), boost::move(w));
+    }
+
+    template <class Clock, class Duration, typename Closure>
+    void submit_at(chrono::time_point<Clock, Duration> const& abs_time, BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w ((boost::forward<Closure>(closure)));
+      schedule(to_steady(abs_time), boost::move(w));
+    }
+
+    /**
+     * Effects: try to execute one task of the underlying executor.
+     * Returns: whether a task has been executed.
+     */
+    bool try_executing_one()
+    {
+      return ex.try_executing_one();
+    }
+
+    /**
+     * \b Requires: This must be called from an scheduled task.
+     *
+     * \b Effects: reschedule functions until pred()
+     */
+    template <typename Pred>
+    bool reschedule_until(Pred const& pred)
+    {
+      return ex.reschedule_until(pred);
+    }
+
+  private:
+    template <class Duration>
+    static clock::time_point to_steady(chrono::time_point<clock, Duration> const& abs_time)
+    {
+      return chrono::time_point_cast<clock::duration>(abs_time);
+    }
+    template <class Clock, class Duration>
+    static clock::time_point to_steady(chrono::time_point<Clock, Duration> const& abs_time)
+    {
+      return clock::now() + chrono::ceil<clock::duration>(abs_time - Clock::now());
+    }
+  };
+}
+using executors::scheduling_adaptor;
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
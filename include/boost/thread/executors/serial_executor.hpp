@@ -15,8 +15,11 @@
 #include <boost/thread/sync_queue.hpp>
 #include <boost/thread/executors/work.hpp>
 #include <boost/thread/executors/executor.hpp>
-#include <boost/thread/future.hpp>
-#include <boost/thread/scoped_thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/thread_only.hpp>
+#include <boost/thread/csbl/deque.hpp>
+#include <boost/optional.hpp>
 
 #include <boost/config/abi_prefix.hpp>
 
@@ -24,142 +27,211 @@ namespace boost
 {
 namespace executors
 {
+  /**
+   * An executor adaptor running the submitted closures one after the other, in submission order, on the underlying executor.
+   *
+   * At most one closure of the serial_executor is submitted to the underlying executor at a time. When it has been executed,
+   * the next queued closure, if any, is submitted from the same underlying executor thread, so that neither a dedicated thread
+   * nor a future per closure is needed.
+   */
   class serial_executor
   {
   public:
     /// type-erasure to store the works to do
     typedef  executors::work work;
   private:
-    typedef  scoped_thread<> thread_t;
+    typedef csbl::deque<work> work_queue_type;
 
-    /// the thread safe work queue
-    sync_queue<work > work_queue;
     executor& ex;
-    thread_t thr;
-
-    struct try_executing_one_task {
-      work& task;
-      boost::promise<void> &p;
-      try_executing_one_task(work& task, boost::promise<void> &p)
-      : task(task), p(p) {}
-      void operator()() {
-        task(); // if task() throws promise is not set but as the the program terminates and should terminate there is no need to use try-catch here.
-        p.set_value();
+    mutable mutex mtx_;
+    /// notified when the chain of closures stops running
+    condition_variable idle_;
+    /// the closures waiting for their turn
+    work_queue_type work_queue_;
+    /// whether a closure of this executor is queued on or executed by the underlying executor
+    bool running_;
+    bool closed_;
+    /// the thread executing the current closure, if any, constructed in place as thread::id declares no copy assignment.
+    optional<thread::id> owner_;
+
+    /// the closure submitted to the underlying executor: runs the next queued closure and chains the following one.
+    struct continuation
+    {
+      serial_executor* self;
+      explicit continuation(serial_executor* self) : self(self) {}
+      void operator()()
+      {
+        self->run_chain();
       }
     };
-  public:
+
     /**
-     * Effects: try to execute one task.
-     * Returns: whether a task has been executed.
-     * Throws: whatever the current task constructor throws or the task() throws.
+     * \b Effects: Pops and executes the front closure. The exceptions thrown by the closure are ignored.
      */
-    bool try_executing_one()
+    void execute_front(unique_lock<mutex>& lk)
     {
-      work task;
+      work task = boost::move(work_queue_.front());
+      work_queue_.pop_front();
+      lk.unlock();
       try
       {
-        if (work_queue.try_pull_front(task) == queue_op_status::success)
-        {
-          boost::promise<void> p;
-          try_executing_one_task tmp(task,p);
-          ex.submit(tmp);
-//          ex.submit([&task, &p]()
-//          {
-//            task(); // if task() throws promise is not set but as the the program terminates and should terminate there is no need to use try-catch here.
-//            p.set_value();
-//          });
-          p.get_future().wait();
-          return true;
-        }
-        return false;
-      }
-      catch (std::exception& )
-      {
-        return false;
+        task();
       }
       catch (...)
       {
-        return false;
       }
     }
-  private:
+
     /**
-     * Effects: schedule one task or yields
-     * Throws: whatever the current task constructor throws or the task() throws.
+     * \b Effects: Executes the front closure and submits the next one to the underlying executor.
+     * If the underlying executor doesn't accept it, the remaining closures are executed on the current thread.
      */
-    void schedule_one_or_yield()
+    void run_chain()
     {
-        if ( ! try_executing_one())
+      unique_lock<mutex> lk(mtx_);
+      for (;;)
+      {
+        owner_.emplace(this_thread::get_id());
+        execute_front(lk);
+        lk.lock();
+        owner_ = none;
+        if (work_queue_.empty())
         {
-          this_thread::yield();
+          running_ = false;
+          // notify while the lock is held, as the destructor may complete as soon as it is released.
+          idle_.notify_all();
+          return;
         }
+        lk.unlock();
+        try
+        {
+          submit_continuation();
+          return;
+        }
+        catch (...)
+        {
+          lk.lock();
+        }
+      }
+    }
+
+    void submit_continuation()
+    {
+      continuation c(this);
+      work w ((c));
+      ex.submit(boost::move(w));
     }
 
     /**
-     * The main loop of the worker thread
+     * \b Effects: Queues the closure and, if no closure of this executor is running, submits a continuation to the underlying executor.
+     *
+     * \b Throws: \c sync_queue_is_closed if the executor is closed.
+     * Whatever exception the underlying executor submit throws. In this case the executor is closed and the pending closures discarded.
      */
-    void worker_thread()
+    void push_back(BOOST_THREAD_RV_REF(work) w)
     {
-      while (!closed())
+      unique_lock<mutex> lk(mtx_);
+      if (closed_) throw_exception(sync_queue_is_closed());
+      work_queue_.push_back(boost::move(w));
+      if (running_) return;
+      running_ = true;
+      lk.unlock();
+      try
       {
-        schedule_one_or_yield();
+        submit_continuation();
       }
-      while (try_executing_one())
+      catch (...)
       {
+        lk.lock();
+        closed_ = true;
+        work_queue_.clear();
+        running_ = false;
+        idle_.notify_all();
+        throw;
       }
     }
 
   public:
+    /**
+     * Effects: When called from a closure of this executor, executes the next queued closure on the current thread.
+     * Returns: whether a closure has been executed.
+     */
+    bool try_executing_one()
+    {
+      unique_lock<mutex> lk(mtx_);
+      if (! owner_ || *owner_ != this_thread::get_id() || work_queue_.empty())
+      {
+        return false;
+      }
+      execute_front(lk);
+      return true;
+    }
+
     /// serial_executor is not copyable.
     BOOST_THREAD_NO_COPYABLE(serial_executor)
 
     /**
-     * \b Effects: creates a thread pool that runs closures using one of its closure-executing methods.
+     * \b Effects: creates a serial executor that runs closures on the underlying executor \c ex.
      *
-     * \b Throws: Whatever exception is thrown while initializing the needed resources.
+     * \b Throws: Nothing.
      */
     serial_executor(executor& ex)
-    : ex(ex), thr(&serial_executor::worker_thread, this)
+    : ex(ex), running_(false), closed_(false)
     {
     }
     /**
-     * \b Effects: Destroys the thread pool.
+     * \b Effects: Closes the executor and waits until all the queued closures have been executed.
      *
      * \b Synchronization: The completion of all the closures happen before the completion of the \c serial_executor destructor.
      */
     ~serial_executor()
     {
-      // signal to all the worker thread that there will be no more submissions.
-      close();
+      unique_lock<mutex> lk(mtx_);
+      closed_ = true;
+      while (running_)
+      {
+        idle_.wait(lk);
+      }
+    }
+
+    /**
+     * \b Returns: the underlying executor.
+     */
+    executor& underlying_executor()
+    {
+      return ex;
     }
 
     /**
      * \b Effects: close the \c serial_executor for submissions.
-     * The loop will work until there is no more closures to run.
+     * The already queued closures will be executed.
      */
     void close()
     {
-      work_queue.close();
+      lock_guard<mutex> lk(mtx_);
+      closed_ = true;
     }
 
     /**
-     * \b Returns: whether the pool is closed for submissions.
+     * \b Returns: whether the executor is closed for submissions.
      */
     bool closed()
     {
-      return work_queue.closed();
+      lock_guard<mutex> lk(mtx_);
+      return closed_;
     }
 
     /**
      * \b Requires: \c Closure is a model of \c Callable(void()) and a model of \c CopyConstructible/MoveConstructible.
      *
-     * \b Effects: The specified \c closure will be scheduled for execution at some point in the future.
-     * If invoked closure throws an exception the \c serial_executor will call \c std::terminate, as is the case with threads.
+     * \b Effects: The specified \c closure will be scheduled for execution after all the closures previously submitted to this executor
+     * have been executed. No two closures submitted to this executor are executed concurrently.
+     * If the invoked closure throws an exception, the exception is ignored.
      *
-     * \b Synchronization: completion of \c closure on a particular thread happens before destruction of thread's thread local variables.
+     * \b Synchronization: the completion of a closure happens before the start of the closure submitted after it.
      *
-     * \b Throws: \c sync_queue_is_closed if the thread pool is closed.
-     * Whatever exception that can be throw while storing the closure.
+     * \b Throws: \c sync_queue_is_closed if the executor is closed.
+     * Whatever exception that can be throw while storing the closure or while submitting to the underlying executor.
      */
 
 #if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
@@ -167,23 +239,20 @@ namespace executors
     void submit(Closure & closure)
     {
       work w ((closure));
-      work_queue.push_back(boost::move(w));
-      //work_queue.push(work(closure)); // todo check why this doesn't work
+      push_back(boost::move(w));
     }
 #endif
     void submit(void (*closure)())
     {
       work w ((closure));
-      work_queue.push_back(boost::move(w));
-      //work_queue.push_back(work(closure)); // todo check why this doesn't work
+      push_back(boost::move(w));
     }
 
     template <typename Closure>
     void submit(BOOST_THREAD_RV_REF(Closure) closure)
     {
       work w =boost::move(closure);
-      work_queue.push_back(boost::move(w));
-      //work_queue.push_back(work(boost::move(closure))); // todo check why this doesn't work
+      push_back(boost::move(w));
     }
 
     /**
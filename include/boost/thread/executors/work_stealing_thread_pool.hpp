@@ -0,0 +1,455 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_WORK_STEALING_THREAD_POOL_HPP
+#define BOOST_THREAD_EXECUTORS_WORK_STEALING_THREAD_POOL_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/detail/work_stealing_deque.hpp>
+#include <boost/thread/scoped_thread.hpp>
+#include <boost/thread/sync_queue.hpp>
+#include <boost/thread/tss.hpp>
+#include <boost/thread/executors/work.hpp>
+#include <boost/thread/csbl/vector.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/atomic.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace executors
+{
+  class work_stealing_thread_pool
+  {
+  public:
+    /// type-erasure to store the works to do
+    typedef  executors::work work;
+  private:
+    /// the kind of stored threads are scoped threads to ensure that the threads are joined.
+    /// A move aware vector type
+    typedef scoped_thread<> thread_t;
+    typedef csbl::vector<thread_t> thread_vector;
+
+    /// the local queue of a worker thread.
+    typedef detail::work_stealing_deque<work*> local_queue;
+
+    /// the number of worker threads
+    unsigned const thread_count_;
+    /// the local queues, one by worker thread
+    scoped_array<local_queue> local_queues_;
+    /// the thread safe queue storing the closures submitted from outside the pool
+    sync_queue<work> work_queue;
+    /// whether the pool is closed for submissions
+    atomic<bool> closed_;
+    /// parking lot of the idle worker threads
+    mutex idle_mtx_;
+    condition_variable idle_cv_;
+    atomic<unsigned> idle_count_;
+    /// the local queue of the current thread if it is one of the worker threads of this pool
+    thread_specific_ptr<local_queue> current_queue_;
+    /// A move aware vector
+    thread_vector threads;
+
+    static void no_cleanup(local_queue*) {}
+
+    /**
+     * Effects: execute \c task, swallowing any exception it throws.
+     */
+    static void execute(work& task)
+    {
+      try
+      {
+        task();
+      }
+      catch (...)
+      {
+      }
+    }
+
+    /**
+     * Effects: look for a closure in the local queue of the current thread if any, then in the shared queue,
+     * then in the local queues of the other workers.
+     * Returns: whether a closure has been found.
+     */
+    bool find_work(work& task)
+    {
+      work* ptr = 0;
+      local_queue* self = current_queue_.get();
+      if (self && self->take(ptr))
+      {
+        return pick(ptr, task);
+      }
+      if (work_queue.try_pull_front(task) == queue_op_status::success)
+      {
+        return true;
+      }
+      unsigned first = self ? unsigned(self - local_queues_.get()) : 0;
+      for (unsigned i = 0; i < thread_count_; ++i)
+      {
+        local_queue& victim = local_queues_[(first + i) % thread_count_];
+        if (&victim != self && victim.steal(ptr))
+        {
+          return pick(ptr, task);
+        }
+      }
+      return false;
+    }
+
+    static bool pick(work* ptr, work& task)
+    {
+      task = boost::move(*ptr);
+      delete ptr;
+      return true;
+    }
+
+    bool has_work()
+    {
+      for (unsigned i = 0; i < thread_count_; ++i)
+      {
+        if (! local_queues_[i].empty()) return true;
+      }
+      return ! work_queue.empty();
+    }
+
+    /**
+     * Effects: wakes up one parked worker if any.
+     */
+    void notify_idle()
+    {
+      atomic_thread_fence(memory_order_seq_cst);
+      if (idle_count_.load(memory_order_relaxed) > 0)
+      {
+        {
+          lock_guard<mutex> lk(idle_mtx_);
+        }
+        idle_cv_.notify_one();
+      }
+    }
+
+    /**
+     * Effects: block the current worker until there is some work to do or the pool is closed.
+     */
+    void park()
+    {
+      unique_lock<mutex> lk(idle_mtx_);
+      idle_count_.fetch_add(1, memory_order_seq_cst);
+      atomic_thread_fence(memory_order_seq_cst);
+      if (! closed() && ! has_work())
+      {
+        idle_cv_.wait(lk);
+      }
+      idle_count_.fetch_sub(1, memory_order_relaxed);
+    }
+
+    /**
+     * The main loop of the worker threads: run the available closures, spin at most
+     * \c BOOST_THREAD_POOL_SPIN_COUNT times when there is none and then park.
+     * Returns once the pool is closed and there is no more closures to run.
+     */
+    void schedule_until_closed(unsigned index)
+    {
+      current_queue_.reset(&local_queues_[index]);
+      unsigned spins = 0;
+      for (;;)
+      {
+        work task;
+        if (find_work(task))
+        {
+          spins = 0;
+          execute(task);
+        }
+        else if (closed() && ! has_work())
+        {
+          break;
+        }
+        else if (spins < BOOST_THREAD_POOL_SPIN_COUNT)
+        {
+          ++spins;
+          this_thread::yield();
+        }
+        else
+        {
+          spins = 0;
+          park();
+        }
+      }
+      current_queue_.reset();
+    }
+
+    void worker_thread(unsigned index)
+    {
+      schedule_until_closed(index);
+    }
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <class AtThreadEntry>
+    void worker_thread1(unsigned index, AtThreadEntry& at_thread_entry)
+    {
+      at_thread_entry(*this);
+      schedule_until_closed(index);
+    }
+#endif
+    void worker_thread2(unsigned index, void(*at_thread_entry)(work_stealing_thread_pool&))
+    {
+      at_thread_entry(*this);
+      schedule_until_closed(index);
+    }
+    template <class AtThreadEntry>
+    void worker_thread3(unsigned index, BOOST_THREAD_FWD_REF(AtThreadEntry) at_thread_entry)
+    {
+      at_thread_entry(*this);
+      schedule_until_closed(index);
+    }
+
+  public:
+    /// work_stealing_thread_pool is not copyable.
+    BOOST_THREAD_NO_COPYABLE(work_stealing_thread_pool)
+
+    /**
+     * \b Requires: \c thread_count > 0.
+     *
+     * \b Effects: creates a thread pool that runs closures on \c thread_count threads.
+     *
+     * \b Throws: Whatever exception is thrown while initializing the needed resources.
+     */
+    work_stealing_thread_pool(unsigned const thread_count = thread::hardware_concurrency())
+    : thread_count_(thread_count), local_queues_(new local_queue[thread_count]),
+      closed_(false), idle_count_(0), current_queue_(&no_cleanup)
+    {
+      try
+      {
+        threads.reserve(thread_count);
+        for (unsigned i = 0; i < thread_count; ++i)
+        {
+          thread th (&work_stealing_thread_pool::worker_thread, this, i);
+          threads.push_back(thread_t(boost::move(th)));
+        }
+      }
+      catch (...)
+      {
+        close();
+        throw;
+      }
+    }
+    /**
+     * \b Requires: \c thread_count > 0.
+     *
+     * \b Effects: creates a thread pool that runs closures on \c thread_count threads
+     * and executes the at_thread_entry function at the entry of each created thread. .
+     *
+     * \b Throws: Whatever exception is thrown while initializing the needed resources.
+     */
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <class AtThreadEntry>
+    work_stealing_thread_pool( unsigned const thread_count, AtThreadEntry& at_thread_entry)
+    : thread_count_(thread_count), local_queues_(new local_queue[thread_count]),
+      closed_(false), idle_count_(0), current_queue_(&no_cleanup)
+    {
+      try
+      {
+        threads.reserve(thread_count);
+        for (unsigned i = 0; i < thread_count; ++i)
+        {
+          thread th (&work_stealing_thread_pool::worker_thread1<AtThreadEntry>, this, i, at_thread_entry);
+          threads.push_back(thread_t(boost::move(th)));
+        }
+      }
+      catch (...)
+      {
+        close();
+        throw;
+      }
+    }
+#endif
+    work_stealing_thread_pool( unsigned const thread_count, void(*at_thread_entry)(work_stealing_thread_pool&))
+    : thread_count_(thread_count), local_queues_(new local_queue[thread_count]),
+      closed_(false), idle_count_(0), current_queue_(&no_cleanup)
+    {
+      try
+      {
+        threads.reserve(thread_count);
+        for (unsigned i = 0; i < thread_count; ++i)
+        {
+          thread th (&work_stealing_thread_pool::worker_thread2, this, i, at_thread_entry);
+          threads.push_back(thread_t(boost::move(th)));
+        }
+      }
+      catch (...)
+      {
+        close();
+        throw;
+      }
+    }
+    template <class AtThreadEntry>
+    work_stealing_thread_pool( unsigned const thread_count, BOOST_THREAD_FWD_REF(AtThreadEntry) at_thread_entry)
+    : thread_count_(thread_count), local_queues_(new local_queue[thread_count]),
+      closed_(false), idle_count_(0), current_queue_(&no_cleanup)
+    {
+      try
+      {
+        threads.reserve(thread_count);
+        for (unsigned i = 0; i < thread_count; ++i)
+        {
+          thread th (&work_stealing_thread_pool::worker_thread3<AtThreadEntry>, this, i, boost::forward<AtThreadEntry>(at_thread_entry));
+          threads.push_back(thread_t(boost::move(th)));
+        }
+      }
+      catch (...)
+      {
+        close();
+        throw;
+      }
+    }
+    /**
+     * \b Effects: Destroys the thread pool.
+     *
+     * \b Synchronization: The completion of all the closures happen before the completion of the \c work_stealing_thread_pool destructor.
+     */
+    ~work_stealing_thread_pool()
+    {
+      // signal to all the worker threads that there will be no more submissions.
+      close();
+      // joins all the threads as the threads were scoped_threads
+      threads.clear();
+      // release the closures that could have been left on the local queues
+      work* ptr = 0;
+      for (unsigned i = 0; i < thread_count_; ++i)
+      {
+        while (local_queues_[i].steal(ptr))
+        {
+          delete ptr;
+        }
+      }
+    }
+
+    /**
+     * \b Effects: close the \c work_stealing_thread_pool for submissions.
+     * The worker threads will work until there is no more closures to run.
+     */
+    void close()
+    {
+      closed_.store(true);
+      work_queue.close();
+      {
+        lock_guard<mutex> lk(idle_mtx_);
+      }
+      idle_cv_.notify_all();
+    }
+
+    /**
+     * \b Returns: whether the pool is closed for submissions.
+     */
+    bool closed()
+    {
+      return closed_.load();
+    }
+
+    /**
+     * \b Requires: \c Closure is a model of \c Callable(void()) and a model of \c CopyConstructible/MoveConstructible.
+     *
+     * \b Effects: The specified \c closure will be scheduled for execution at some point in the future.
+     * When called from one of the worker threads of the pool the closure is pushed on the local queue of this worker,
+     * which will run it next unless another idle worker steals it. Otherwise the closure is pushed on the shared queue.
+     * If invoked closure throws an exception the \c work_stealing_thread_pool will call \c std::terminate, as is the case with threads.
+     *
+     * \b Synchronization: completion of \c closure on a particular thread happens before destruction of thread's thread local variables.
+     *
+     * \b Throws: \c sync_queue_is_closed if the thread pool is closed.
+     * Whatever exception that can be throw while storing the closure.
+     */
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    template <typename Closure>
+    void submit(Closure & closure)
+    {
+      work w((closure));
+      submit_work(w);
+    }
+#endif
+    void submit(void (*closure)())
+    {
+      work w((closure));
+      submit_work(w);
+    }
+
+    template <typename Closure>
+    void submit(BOOST_THREAD_FWD_REF(Closure) closure)
+    {
+      work w((boost::forward<Closure>(closure)));
+      submit_work(w);
+    }
+
+    /**
+     * \b Effects: try to execute one task.
+     *
+     * \b Returns: whether a task has been executed.
+     */
+    bool try_executing_one()
+    {
+      work task;
+      if (find_work(task))
+      {
+        execute(task);
+        return true;
+      }
+      return false;
+    }
+
+    /**
+     * \b Effects: schedule one task or yields
+     */
+    void schedule_one_or_yield()
+    {
+      if ( ! try_executing_one())
+      {
+        this_thread::yield();
+      }
+    }
+
+    /**
+     * \b Requires: This must be called from an scheduled task.
+     *
+     * \b Effects: reschedule functions until pred()
+     */
+    template <typename Pred>
+    bool reschedule_until(Pred const& pred)
+    {
+      do {
+        if ( ! try_executing_one())
+        {
+          return false;
+        }
+      } while (! pred());
+      return true;
+    }
+
+  private:
+    void submit_work(work& w)
+    {
+      if (closed())
+      {
+        BOOST_THROW_EXCEPTION( sync_queue_is_closed() );
+      }
+      local_queue* self = current_queue_.get();
+      if (self)
+      {
+        self->push(new work(boost::move(w)));
+      }
+      else
+      {
+        work_queue.push_back(boost::move(w));
+      }
+      notify_idle();
+    }
+  };
+}
+using executors::work_stealing_thread_pool;
+
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
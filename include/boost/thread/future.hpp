@@ -27,6 +27,8 @@
 #include <boost/thread/lock_types.hpp>
 #include <boost/exception_ptr.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/atomic.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <boost/type_traits/is_fundamental.hpp>
 #include <boost/thread/detail/is_convertible.hpp>
@@ -46,6 +48,7 @@
 #include <list>
 #include <boost/next_prior.hpp>
 #include <vector>
+#include <utility>
 
 #include <boost/thread/future_error_code.hpp>
 #ifdef BOOST_THREAD_USES_CHRONO
@@ -63,6 +66,13 @@
 #include <boost/utility/result_of.hpp>
 #include <boost/thread/thread_only.hpp>
 
+#if defined BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR
+#include <boost/thread/executors/default_executor.hpp>
+#endif
+#if defined BOOST_THREAD_FUTURE_USES_CACHING_ALLOCATOR
+#include <boost/thread/caching_allocator.hpp>
+#endif
+
 #if defined BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY
 #include <boost/thread/csbl/tuple.hpp>
 #include <boost/thread/csbl/vector.hpp>
@@ -85,6 +95,9 @@ namespace boost
       deferred = 2,
 #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
       executor = 4,
+#endif
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+      sync = 8,
 #endif
       any = async | deferred
   }
@@ -176,6 +189,15 @@ namespace boost
         {}
     };
 
+    class BOOST_SYMBOL_VISIBLE future_cancelled:
+        public future_error
+    {
+    public:
+        future_cancelled():
+          future_error(system::make_error_code(future_errc::operation_cancelled))
+        {}
+    };
+
     namespace future_state
     {
         enum state { uninitialized, waiting, ready, moved, deferred };
@@ -210,42 +232,104 @@ namespace boost
             relocker& operator=(relocker const&);
         };
 
+        /// Node of the intrusive list of the waiters registered on a shared state, notified once, with the mutex of
+        /// the shared state locked, when the state becomes ready.
+        struct future_waiter_node
+        {
+            future_waiter_node* prev_;
+            future_waiter_node* next_;
+
+            future_waiter_node(): prev_(0), next_(0) {}
+            virtual ~future_waiter_node() {}
+            virtual void notify_ready() = 0;
+        };
+
+        struct sync_continuation_runner;
+
         struct shared_state_base : enable_shared_from_this<shared_state_base>
         {
-            typedef std::list<boost::condition_variable_any*> waiter_list;
             // This type should be only included conditionally if interruptions are allowed, but is included to maintain the same layout.
             typedef shared_ptr<shared_state_base> continuation_ptr_type;
+            // the continuations taken from their ready parents, to be launched later with the mutex of the parent locked.
+            typedef std::vector<std::pair<continuation_ptr_type, continuation_ptr_type> > continuations_type;
 
             boost::exception_ptr exception;
-            bool done;
+            // set with release semantics once the result or the exception is stored, so that a ready state can be
+            // queried and read without taking the mutex.
+            boost::atomic<bool> done;
             bool is_deferred_;
             launch policy_;
             bool is_constructed;
             mutable boost::mutex mutex;
             boost::condition_variable waiters;
-            waiter_list external_waiters;
+            // the waiters of wait_for_any.
+            future_waiter_node* external_waiters;
             boost::function<void()> callback;
             // This declaration should be only included conditionally if interruptions are allowed, but is included to maintain the same layout.
             bool thread_was_interrupted;
             // This declaration should be only included conditionally, but is included to maintain the same layout.
             continuation_ptr_type continuation_ptr;
+            // the continuations set while continuation_ptr was already set, as several continuations or when_all/when_any
+            // can be attached to the shared state of a shared_future.
+            std::vector<continuation_ptr_type> continuations;
 
             // This declaration should be only included conditionally, but is included to maintain the same layout.
             virtual void launch_continuation(boost::unique_lock<boost::mutex>&)
             {
             }
 
+            /// the runner of the inline continuation of this state, if it is one, found without RTTI.
+            virtual sync_continuation_runner* as_sync_runner()
+            {
+                return 0;
+            }
+
             shared_state_base():
                 done(false),
                 is_deferred_(false),
                 policy_(launch::none),
                 is_constructed(false),
+                external_waiters(0),
                 thread_was_interrupted(false),
                 continuation_ptr()
             {}
             virtual ~shared_state_base()
             {}
 
+            /// whether the state is ready. Once it is, the result, exception and thread_was_interrupted don't change
+            /// anymore and can be read without the mutex.
+            bool is_done() const BOOST_NOEXCEPT
+            {
+                return done.load(boost::memory_order_acquire);
+            }
+
+            /// Requires: is_done()
+            void rethrow_if_failed() const
+            {
+#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
+                if(thread_was_interrupted)
+                {
+                    throw boost::thread_interrupted();
+                }
+#endif
+                if(exception)
+                {
+                    boost::rethrow_exception(exception);
+                }
+            }
+
+#if defined BOOST_THREAD_FUTURE_USES_CACHING_ALLOCATOR
+            // the shared states created without allocator are recycled through the per-thread cache of caching_allocator.
+            static void* operator new(std::size_t n)
+            {
+              return thread_detail::thread_block_cache::allocate_block(n);
+            }
+            static void operator delete(void* p, std::size_t n)
+            {
+              thread_detail::thread_block_cache::deallocate_block(p, n);
+            }
+#endif
+
             void set_deferred()
             {
               is_deferred_ = true;
@@ -255,7 +339,22 @@ namespace boost
             {
               is_deferred_ = false;
               policy_ = launch::async;
+#if defined BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR
+              // a thread of the default executor waiting for an async result runs the closures queued meanwhile,
+              // as the result may be one of them.
+              if (! callback)
+              {
+                callback = boost::bind(&shared_state_base::run_queued_default_closures, this);
+              }
+#endif
+            }
+#if defined BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR
+            void run_queued_default_closures()
+            {
+              executors::detail::run_queued_default_closures_until(
+                  boost::bind(&shared_state_base::is_done, this));
             }
+#endif
 #ifdef BOOST_THREAD_PROVIDES_EXECUTORS
             void set_executor()
             {
@@ -263,26 +362,57 @@ namespace boost
               policy_ = launch::executor;
             }
 #endif
-            waiter_list::iterator register_external_waiter(boost::condition_variable_any& cv)
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+            void set_sync()
             {
-                boost::unique_lock<boost::mutex> lock(mutex);
-                do_callback(lock);
-                return external_waiters.insert(external_waiters.end(),&cv);
+              is_deferred_ = false;
+              policy_ = launch::sync;
+            }
+#endif
+            /// Requires: the mutex is locked and the state is not ready.
+            void register_external_waiter(future_waiter_node& w)
+            {
+                w.prev_ = 0;
+                w.next_ = external_waiters;
+                if (external_waiters)
+                {
+                    external_waiters->prev_ = &w;
+                }
+                external_waiters = &w;
             }
 
-            void remove_external_waiter(waiter_list::iterator it)
+            /// Requires: the mutex is locked and w is registered.
+            void remove_external_waiter(future_waiter_node& w)
             {
-                boost::lock_guard<boost::mutex> lock(mutex);
-                external_waiters.erase(it);
+                if (w.prev_)
+                {
+                    w.prev_->next_ = w.next_;
+                }
+                else
+                {
+                    external_waiters = w.next_;
+                }
+                if (w.next_)
+                {
+                    w.next_->prev_ = w.prev_;
+                }
+                w.prev_ = w.next_ = 0;
             }
 
 #if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
             void do_continuation(boost::unique_lock<boost::mutex>& lock)
             {
                 if (continuation_ptr) {
-                  continuation_ptr_type this_continuation_ptr = continuation_ptr;
-                  continuation_ptr.reset();
+                  continuation_ptr_type this_continuation_ptr;
+                  this_continuation_ptr.swap(continuation_ptr);
+                  std::vector<continuation_ptr_type> these_continuations;
+                  these_continuations.swap(continuations);
                   this_continuation_ptr->launch_continuation(lock);
+                  for (std::vector<continuation_ptr_type>::iterator it = these_continuations.begin();
+                      it != these_continuations.end(); ++it)
+                  {
+                    (*it)->launch_continuation(lock);
+                  }
                   //if (! lock.owns_lock())
                   //  lock.lock();
                 }
@@ -295,28 +425,64 @@ namespace boost
 #if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
             void set_continuation_ptr(continuation_ptr_type continuation, boost::unique_lock<boost::mutex>& lock)
             {
-              continuation_ptr= continuation;
+              if (continuation_ptr)
+                continuations.push_back(continuation);
+              else
+                continuation_ptr= continuation;
               if (done) {
                 do_continuation(lock);
               }
             }
 #endif
-            void mark_finished_internal(boost::unique_lock<boost::mutex>& lock)
+            void notify_finished()
             {
-                done=true;
+                done.store(true, boost::memory_order_release);
                 waiters.notify_all();
-                for(waiter_list::const_iterator it=external_waiters.begin(),
-                        end=external_waiters.end();it!=end;++it)
+                for(future_waiter_node* w=external_waiters;w!=0;w=w->next_)
                 {
-                    (*it)->notify_all();
+                    w->notify_ready();
                 }
+            }
+            void mark_finished_internal(boost::unique_lock<boost::mutex>& lock)
+            {
+                notify_finished();
                 do_continuation(lock);
             }
+            /// marks the state ready as mark_finished_internal does, but appends its continuations to \c out instead of
+            /// launching them, so that a batch of states can be made ready before any of their continuations runs.
+            void mark_finished_collecting_continuations(boost::unique_lock<boost::mutex>&, continuations_type& out)
+            {
+                notify_finished();
+                if (continuation_ptr)
+                {
+                    continuation_ptr_type self = shared_from_this();
+                    out.push_back(std::make_pair(self, continuation_ptr_type()));
+                    out.back().second.swap(continuation_ptr);
+                    for (std::vector<continuation_ptr_type>::iterator it = continuations.begin();
+                        it != continuations.end(); ++it)
+                    {
+                        out.push_back(std::make_pair(self, *it));
+                    }
+                    continuations.clear();
+                }
+            }
             void make_ready()
             {
               boost::unique_lock<boost::mutex> lock(mutex);
               mark_finished_internal(lock);
             }
+            /// makes the state not ready again, as if freshly constructed, so that it can be reused by its owner once
+            /// nothing else refers to it.
+            void clear_ready_state(boost::unique_lock<boost::mutex>&)
+            {
+                done.store(false, boost::memory_order_relaxed);
+                exception = boost::exception_ptr();
+                is_constructed = false;
+                thread_was_interrupted = false;
+                callback = boost::function<void()>();
+                continuation_ptr.reset();
+                continuations.clear();
+            }
 
             void do_callback(boost::unique_lock<boost::mutex>& lock)
             {
@@ -345,15 +511,9 @@ namespace boost
                   {
                       waiters.wait(lk);
                   }
-#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
-                  if(rethrow && thread_was_interrupted)
-                  {
-                      throw boost::thread_interrupted();
-                  }
-#endif
-                  if(rethrow && exception)
+                  if(rethrow)
                   {
-                      boost::rethrow_exception(exception);
+                      rethrow_if_failed();
                   }
                 }
               }
@@ -361,6 +521,14 @@ namespace boost
 
             virtual void wait(bool rethrow=true)
             {
+                if(is_done())
+                {
+                    if(rethrow)
+                    {
+                        rethrow_if_failed();
+                    }
+                    return;
+                }
                 boost::unique_lock<boost::mutex> lock(mutex);
                 wait_internal(lock, rethrow);
             }
@@ -368,6 +536,8 @@ namespace boost
 #if defined BOOST_THREAD_USES_DATETIME
             bool timed_wait_until(boost::system_time const& target_time)
             {
+                if(is_done())
+                    return true;
                 boost::unique_lock<boost::mutex> lock(mutex);
                 if (is_deferred_)
                     return false;
@@ -390,6 +560,8 @@ namespace boost
             future_status
             wait_until(const chrono::time_point<Clock, Duration>& abs_time)
             {
+              if(is_done())
+                  return future_status::ready;
               boost::unique_lock<boost::mutex> lock(mutex);
               if (is_deferred_)
                   return future_status::deferred;
@@ -407,10 +579,21 @@ namespace boost
 #endif
             void mark_exceptional_finish_internal(boost::exception_ptr const& e, boost::unique_lock<boost::mutex>& lock)
             {
+                // a state made ready by a cancellation drops the late result of its task
+                if (done) return;
                 exception=e;
                 mark_finished_internal(lock);
             }
 
+            /// makes the state ready with a future_cancelled exception unless it is ready already. A deferred task is
+            /// not run anymore and a running one is left to finish, its result being dropped.
+            void mark_cancelled()
+            {
+                boost::unique_lock<boost::mutex> lock(mutex);
+                is_deferred_ = false;
+                mark_exceptional_finish_internal(boost::copy_exception(future_cancelled()), lock);
+            }
+
             void mark_exceptional_finish()
             {
                 boost::unique_lock<boost::mutex> lock(mutex);
@@ -421,6 +604,7 @@ namespace boost
             void mark_interrupted_finish()
             {
                 boost::unique_lock<boost::mutex> lock(mutex);
+                if (done) return;
                 thread_was_interrupted=true;
                 mark_finished_internal(lock);
             }
@@ -452,8 +636,7 @@ namespace boost
 
             bool has_value() const
             {
-                boost::lock_guard<boost::mutex> lock(mutex);
-                return done && !(exception
+                return is_done() && !(exception
 #if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
                     || thread_was_interrupted
 #endif
@@ -471,8 +654,7 @@ namespace boost
 
             bool has_exception()  const
             {
-                boost::lock_guard<boost::mutex> lock(mutex);
-                return done && (exception
+                return is_done() && (exception
 #if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
                     || thread_was_interrupted
 #endif
@@ -499,8 +681,7 @@ namespace boost
 
             future_state::state get_state() const
             {
-                boost::lock_guard<boost::mutex> guard(mutex);
-                if(!done)
+                if(!is_done())
                 {
                     return future_state::waiting;
                 }
@@ -515,6 +696,28 @@ namespace boost
                 boost::unique_lock<boost::mutex> lock(mutex);
                 return get_exception_ptr(lock);
             }
+
+            /// waits as wait(false) does, but takes the mutex even if the state is ready, so that the thread that made
+            /// it ready has released the mutex on return. Used by the destructors of the states made ready by a task
+            /// that doesn't own them.
+            void wait_for_finisher()
+            {
+                boost::unique_lock<boost::mutex> lock(mutex);
+                wait_internal(lock, false);
+            }
+
+            /// waits until the state is ready and rethrows the stored exception if any, taking the mutex only if it
+            /// is not ready yet.
+            void wait_ready()
+            {
+                if(is_done())
+                {
+                    rethrow_if_failed();
+                    return;
+                }
+                boost::unique_lock<boost::mutex> lock(mutex);
+                wait_internal(lock);
+            }
             exception_ptr get_exception_ptr(boost::unique_lock<boost::mutex>& lock)
             {
                 wait_internal(lock, false);
@@ -647,14 +850,22 @@ namespace boost
             ~shared_state()
             {}
 
+            void clear_ready_state(boost::unique_lock<boost::mutex>& lock)
+            {
+                future_traits<T>::cleanup(result);
+                this->shared_state_base::clear_ready_state(lock);
+            }
+
             void mark_finished_with_result_internal(source_reference_type result_, boost::unique_lock<boost::mutex>& lock)
             {
+                if (this->done) return;
                 future_traits<T>::init(result,result_);
                 this->mark_finished_internal(lock);
             }
 
             void mark_finished_with_result_internal(rvalue_source_type result_, boost::unique_lock<boost::mutex>& lock)
             {
+                if (this->done) return;
 #if ! defined  BOOST_NO_CXX11_RVALUE_REFERENCES
                 future_traits<T>::init(result,boost::forward<T>(result_));
 #else
@@ -682,15 +893,13 @@ namespace boost
 
             virtual move_dest_type get()
             {
-                boost::unique_lock<boost::mutex> lock(mutex);
-                wait_internal(lock);
+                wait_ready();
                 return boost::move(*result);
             }
 
             virtual shared_future_get_result_type get_sh()
             {
-                boost::unique_lock<boost::mutex> lock(mutex);
-                wait_internal(lock);
+                wait_ready();
                 return *result;
             }
 
@@ -745,8 +954,15 @@ namespace boost
             {
             }
 
+            void clear_ready_state(boost::unique_lock<boost::mutex>& lock)
+            {
+                result= 0;
+                this->shared_state_base::clear_ready_state(lock);
+            }
+
             void mark_finished_with_result_internal(source_reference_type result_, boost::unique_lock<boost::mutex>& lock)
             {
+                if (done) return;
                 //future_traits<T>::init(result,result_);
                 result= &result_;
                 mark_finished_internal(lock);
@@ -760,15 +976,13 @@ namespace boost
 
             virtual T& get()
             {
-                boost::unique_lock<boost::mutex> lock(mutex);
-                wait_internal(lock);
+                wait_ready();
                 return *result;
             }
 
             virtual T& get_sh()
             {
-                boost::unique_lock<boost::mutex> lock(mutex);
-                wait_internal(lock);
+                wait_ready();
                 return *result;
             }
 
@@ -799,6 +1013,7 @@ namespace boost
 
             void mark_finished_with_result_internal(boost::unique_lock<boost::mutex>& lock)
             {
+                if (done) return;
                 mark_finished_internal(lock);
             }
 
@@ -810,14 +1025,12 @@ namespace boost
 
             virtual void get()
             {
-                boost::unique_lock<boost::mutex> lock(mutex);
-                this->wait_internal(lock);
+                this->wait_ready();
             }
 
             virtual void get_sh()
             {
-                boost::unique_lock<boost::mutex> lock(mutex);
-                this->wait_internal(lock);
+                this->wait_ready();
             }
 
             void set_value_at_thread_exit()
@@ -871,6 +1084,32 @@ namespace boost
           }
         };
 
+#if defined BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR
+        /////////////////////////
+        /// future_async_shared_state_task: runs a future_async_shared_state on the default executor
+        /////////////////////////
+        template<typename State, typename Fp>
+        struct future_async_shared_state_task
+        {
+          State* that;
+          Fp f_;
+        public:
+          BOOST_THREAD_MOVABLE_ONLY(future_async_shared_state_task)
+          future_async_shared_state_task(State* st, BOOST_THREAD_FWD_REF(Fp) f)
+          : that(st), f_(boost::forward<Fp>(f))
+          {}
+          future_async_shared_state_task(BOOST_THREAD_RV_REF(future_async_shared_state_task) x) BOOST_NOEXCEPT
+          : that(x.that), f_(boost::move(x.f_))
+          {
+            x.that=0;
+          }
+          void operator()()
+          {
+            State::run(that, boost::move(f_));
+          }
+        };
+#endif
+
         /////////////////////////
         /// future_async_shared_state
         /////////////////////////
@@ -880,10 +1119,23 @@ namespace boost
           typedef future_async_shared_state_base<Rp> base_type;
 
         public:
-          explicit future_async_shared_state(BOOST_THREAD_FWD_REF(Fp) f) :
-          base_type(thread(&future_async_shared_state::run, this, boost::forward<Fp>(f)))
+#if defined BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR
+          explicit future_async_shared_state(BOOST_THREAD_FWD_REF(Fp) f)
+          {
+            future_async_shared_state_task<future_async_shared_state, Fp> t(this, boost::forward<Fp>(f));
+            executors::default_executor().submit(boost::move(t));
+          }
+          ~future_async_shared_state()
           {
+            this->wait_for_finisher();
           }
+#else
+          explicit future_async_shared_state(BOOST_THREAD_FWD_REF(Fp) f)
+          {
+            // the thread is started once the shared state has been constructed, as it may lock it at once.
+            this->thr_ = thread(&future_async_shared_state::run, this, boost::forward<Fp>(f));
+          }
+#endif
 
           static void run(future_async_shared_state* that, BOOST_THREAD_FWD_REF(Fp) f)
           {
@@ -910,10 +1162,23 @@ namespace boost
           typedef future_async_shared_state_base<void> base_type;
 
         public:
-          explicit future_async_shared_state(BOOST_THREAD_FWD_REF(Fp) f) :
-          base_type(thread(&future_async_shared_state::run, this, boost::forward<Fp>(f)))
+#if defined BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR
+          explicit future_async_shared_state(BOOST_THREAD_FWD_REF(Fp) f)
           {
+            future_async_shared_state_task<future_async_shared_state, Fp> t(this, boost::forward<Fp>(f));
+            executors::default_executor().submit(boost::move(t));
           }
+          ~future_async_shared_state()
+          {
+            this->wait_for_finisher();
+          }
+#else
+          explicit future_async_shared_state(BOOST_THREAD_FWD_REF(Fp) f)
+          {
+            // the thread is started once the shared state has been constructed, as it may lock it at once.
+            this->thr_ = thread(&future_async_shared_state::run, this, boost::forward<Fp>(f));
+          }
+#endif
 
           static void run(future_async_shared_state* that, BOOST_THREAD_FWD_REF(Fp) f)
           {
@@ -941,10 +1206,23 @@ namespace boost
           typedef future_async_shared_state_base<Rp&> base_type;
 
         public:
-          explicit future_async_shared_state(BOOST_THREAD_FWD_REF(Fp) f) :
-          base_type(thread(&future_async_shared_state::run, this, boost::forward<Fp>(f)))
+#if defined BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR
+          explicit future_async_shared_state(BOOST_THREAD_FWD_REF(Fp) f)
+          {
+            future_async_shared_state_task<future_async_shared_state, Fp> t(this, boost::forward<Fp>(f));
+            executors::default_executor().submit(boost::move(t));
+          }
+          ~future_async_shared_state()
           {
+            this->wait_for_finisher();
           }
+#else
+          explicit future_async_shared_state(BOOST_THREAD_FWD_REF(Fp) f)
+          {
+            // the thread is started once the shared state has been constructed, as it may lock it at once.
+            this->thr_ = thread(&future_async_shared_state::run, this, boost::forward<Fp>(f));
+          }
+#endif
 
           static void run(future_async_shared_state* that, BOOST_THREAD_FWD_REF(Fp) f)
           {
@@ -1061,63 +1339,55 @@ namespace boost
 //              : alloc_(a) {}
 //
 //        };
+        /**
+         * Waits until one of the futures added is ready. A node registered on each shared state records the index of
+         * the first future to become ready in an atomic slot and wakes up the waiting thread, so that a completion costs
+         * O(1) whatever the number of futures and the waiting thread doesn't lock all the futures together.
+         */
         class future_waiter
         {
-            struct registered_waiter;
             typedef std::vector<int>::size_type count_type;
 
-            struct registered_waiter
+            struct registered_waiter: future_waiter_node
             {
                 boost::shared_ptr<detail::shared_state_base> future_;
-                detail::shared_state_base::waiter_list::iterator wait_iterator;
                 count_type index;
+                future_waiter* waiter_;
+                bool registered_;
 
                 registered_waiter(boost::shared_ptr<detail::shared_state_base> const& a_future,
-                                  detail::shared_state_base::waiter_list::iterator wait_iterator_,
-                                  count_type index_):
-                    future_(a_future),wait_iterator(wait_iterator_),index(index_)
+                                  count_type index_, future_waiter* waiter):
+                    future_(a_future),index(index_),waiter_(waiter),registered_(false)
                 {}
-            };
-
-            struct all_futures_lock
-            {
-#ifdef _MANAGED
-                   typedef std::ptrdiff_t count_type_portable;
-#else
-                   typedef count_type count_type_portable;
-#endif
-                   count_type_portable count;
-                   boost::scoped_array<boost::unique_lock<boost::mutex> > locks;
-
-                all_futures_lock(std::vector<registered_waiter>& futures):
-                    count(futures.size()),locks(new boost::unique_lock<boost::mutex>[count])
-                {
-                    for(count_type_portable i=0;i<count;++i)
-                    {
-                        locks[i]=BOOST_THREAD_MAKE_RV_REF(boost::unique_lock<boost::mutex>(futures[i].future_->mutex));
-                    }
-                }
-
-                void lock()
-                {
-                    boost::lock(locks.get(),locks.get()+count);
-                }
 
-                void unlock()
+                virtual void notify_ready()
                 {
-                    for(count_type_portable i=0;i<count;++i)
-                    {
-                        locks[i].unlock();
-                    }
+                    waiter_->notify_ready(index);
                 }
             };
 
-            boost::condition_variable_any cv;
+            // the index of the first future found ready, or no_index.
+            boost::atomic<count_type> first_ready;
+            boost::mutex mutex;
+            boost::condition_variable cv;
             std::vector<registered_waiter> futures;
             count_type future_count;
 
+            BOOST_STATIC_CONSTANT(count_type, no_index = static_cast<count_type>(-1));
+
+            void notify_ready(count_type index)
+            {
+                count_type none = no_index;
+                if (first_ready.compare_exchange_strong(none, index, boost::memory_order_acq_rel))
+                {
+                    boost::lock_guard<boost::mutex> lk(mutex);
+                    cv.notify_one();
+                }
+            }
+
         public:
             future_waiter():
+                first_ready(no_index),
                 future_count(0)
             {}
 
@@ -1126,13 +1396,7 @@ namespace boost
             {
                 if(f.future_)
                 {
-                  registered_waiter waiter(f.future_,f.future_->register_external_waiter(cv),future_count);
-                  try {
-                      futures.push_back(waiter);
-                  } catch(...) {
-                    f.future_->remove_external_waiter(waiter.wait_iterator);
-                    throw;
-                  }
+                    futures.push_back(registered_waiter(f.future_,future_count,this));
                 }
                 ++future_count;
             }
@@ -1147,25 +1411,39 @@ namespace boost
 
             count_type wait()
             {
-                all_futures_lock lk(futures);
-                for(;;)
+                // the futures can't be added anymore, so that the nodes don't move once registered.
+                for(count_type i=0;i<futures.size() && first_ready.load(boost::memory_order_acquire)==no_index;++i)
                 {
-                    for(count_type i=0;i<futures.size();++i)
+                    registered_waiter& w=futures[i];
+                    boost::unique_lock<boost::mutex> lk(w.future_->mutex);
+                    w.future_->do_callback(lk);
+                    if(w.future_->done)
+                    {
+                        notify_ready(w.index);
+                    }
+                    else
                     {
-                        if(futures[i].future_->done)
-                        {
-                            return futures[i].index;
-                        }
+                        w.future_->register_external_waiter(w);
+                        w.registered_=true;
                     }
+                }
+                boost::unique_lock<boost::mutex> lk(mutex);
+                while(first_ready.load(boost::memory_order_acquire)==no_index)
+                {
                     cv.wait(lk);
                 }
+                return first_ready.load(boost::memory_order_acquire);
             }
 
             ~future_waiter()
             {
                 for(count_type i=0;i<futures.size();++i)
                 {
-                    futures[i].future_->remove_external_waiter(futures[i].wait_iterator);
+                    if(futures[i].registered_)
+                    {
+                        boost::lock_guard<boost::mutex> lk(futures[i].future_->mutex);
+                        futures[i].future_->remove_external_waiter(futures[i]);
+                    }
                 }
             }
 
@@ -1326,6 +1604,14 @@ namespace boost
     template <typename R>
     class packaged_task;
 
+    class cancellation_token;
+
+    namespace detail
+    {
+      template <typename R>
+      class promise_batch_base;
+    }
+
     namespace detail
     {
       /// Common implementation for all the futures independently of the return type
@@ -1506,6 +1792,21 @@ namespace boost
         template <class F, class Rp, class Fp>
         BOOST_THREAD_FUTURE<Rp>
         make_future_deferred_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+
+        template<typename F, typename Rp, typename Fp>
+        struct future_sync_continuation_shared_state;
+
+        template <class F, class Rp, class Fp>
+        BOOST_THREAD_FUTURE<Rp>
+        make_future_sync_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+        template<typename Ex, typename F, typename Rp, typename Fp>
+        struct future_executor_continuation_shared_state;
+
+        template <class Ex, class F, class Rp, class Fp>
+        BOOST_THREAD_FUTURE<Rp>
+        make_future_executor_continuation_shared_state(Ex& ex, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+#endif
 #endif
 #if defined BOOST_THREAD_PROVIDES_FUTURE_UNWRAP
         template<typename F, typename Rp>
@@ -1538,6 +1839,21 @@ namespace boost
         template <class F, class Rp, class Fp>
         friend BOOST_THREAD_FUTURE<Rp>
         detail::make_future_deferred_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+
+        template <typename, typename, typename>
+        friend struct detail::future_sync_continuation_shared_state;
+
+        template <class F, class Rp, class Fp>
+        friend BOOST_THREAD_FUTURE<Rp>
+        detail::make_future_sync_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+        template <typename, typename, typename, typename>
+        friend struct detail::future_executor_continuation_shared_state;
+
+        template <class Ex, class F, class Rp, class Fp>
+        friend BOOST_THREAD_FUTURE<Rp>
+        detail::make_future_executor_continuation_shared_state(Ex& ex, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+#endif
 #endif
 #if defined BOOST_THREAD_PROVIDES_FUTURE_UNWRAP
         template<typename F, typename Rp>
@@ -1695,6 +2011,22 @@ namespace boost
         template<typename F>
         inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type>
         then(launch policy, BOOST_THREAD_FWD_REF(F) func);  // EXTENSION
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+        template<typename Ex, typename F>
+        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type>
+        then(Ex& ex, BOOST_THREAD_FWD_REF(F) func);  // EXTENSION
+#endif
+#if ! defined BOOST_NO_CXX11_VARIADIC_TEMPLATES && ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+        // defined in <boost/thread/cancellation.hpp>
+        template<typename F>
+        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type>
+        then(cancellation_token tk, launch policy, BOOST_THREAD_FWD_REF(F) func);  // EXTENSION
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+        template<typename Ex, typename F>
+        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE)>::type>
+        then(cancellation_token tk, Ex& ex, BOOST_THREAD_FWD_REF(F) func);  // EXTENSION
+#endif
+#endif
 
         template <typename R2>
         inline typename boost::disable_if< is_void<R2>, BOOST_THREAD_FUTURE<R> >::type
@@ -1743,6 +2075,21 @@ namespace boost
             template <class F, class Rp, class Fp>
             friend BOOST_THREAD_FUTURE<Rp>
             detail::make_future_deferred_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+
+            template <typename, typename, typename>
+            friend struct detail::future_sync_continuation_shared_state;
+
+            template <class F, class Rp, class Fp>
+            friend BOOST_THREAD_FUTURE<Rp>
+            detail::make_future_sync_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+            template <typename, typename, typename, typename>
+            friend struct detail::future_executor_continuation_shared_state;
+
+            template <class Ex, class F, class Rp, class Fp>
+            friend BOOST_THREAD_FUTURE<Rp>
+            detail::make_future_executor_continuation_shared_state(Ex& ex, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+#endif
     #endif
 #if defined BOOST_THREAD_PROVIDES_FUTURE_UNWRAP
             template<typename F, typename Rp>
@@ -1917,6 +2264,21 @@ namespace boost
         template <class F, class Rp, class Fp>
         friend BOOST_THREAD_FUTURE<Rp>
         detail::make_future_deferred_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+
+        template <typename, typename, typename>
+        friend struct detail::future_sync_continuation_shared_state;
+
+        template <class F, class Rp, class Fp>
+        friend BOOST_THREAD_FUTURE<Rp>
+        detail::make_future_sync_continuation_shared_state(boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+        template <typename, typename, typename, typename>
+        friend struct detail::future_executor_continuation_shared_state;
+
+        template <class Ex, class F, class Rp, class Fp>
+        friend BOOST_THREAD_FUTURE<Rp>
+        detail::make_future_executor_continuation_shared_state(Ex& ex, boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c);
+#endif
 #endif
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK
         template <class> friend class packaged_task;// todo check if this works in windows
@@ -2026,6 +2388,22 @@ namespace boost
         template<typename F>
         inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future)>::type>
         then(launch policy, BOOST_THREAD_FWD_REF(F) func); // EXTENSION
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+        template<typename Ex, typename F>
+        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future)>::type>
+        then(Ex& ex, BOOST_THREAD_FWD_REF(F) func); // EXTENSION
+#endif
+#if ! defined BOOST_NO_CXX11_VARIADIC_TEMPLATES && ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+        // defined in <boost/thread/cancellation.hpp>
+        template<typename F>
+        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future)>::type>
+        then(cancellation_token tk, launch policy, BOOST_THREAD_FWD_REF(F) func); // EXTENSION
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+        template<typename Ex, typename F>
+        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future)>::type>
+        then(cancellation_token tk, Ex& ex, BOOST_THREAD_FWD_REF(F) func); // EXTENSION
+#endif
+#endif
 #endif
 //#if defined BOOST_THREAD_PROVIDES_FUTURE_UNWRAP
 //        inline
@@ -2057,6 +2435,7 @@ namespace boost
 
         future_ptr future_;
         bool future_obtained;
+        friend class detail::promise_batch_base<R>;
 
         void lazy_init()
         {
@@ -2077,11 +2456,8 @@ namespace boost
         template <class Allocator>
         promise(boost::allocator_arg_t, Allocator a)
         {
-          typedef typename Allocator::template rebind<detail::shared_state<R> >::other A2;
-          A2 a2(a);
-          typedef thread_detail::allocator_destructor<A2> D;
-
-          future_ = future_ptr(::new(a2.allocate(1)) detail::shared_state<R>(), D(a2, 1) );
+          // the shared state and its reference count are allocated as a single block
+          future_ = boost::allocate_shared<detail::shared_state<R> >(a);
           future_obtained = false;
         }
 #endif
@@ -2255,11 +2631,8 @@ namespace boost
         template <class Allocator>
         promise(boost::allocator_arg_t, Allocator a)
         {
-          typedef typename Allocator::template rebind<detail::shared_state<R&> >::other A2;
-          A2 a2(a);
-          typedef thread_detail::allocator_destructor<A2> D;
-
-          future_ = future_ptr(::new(a2.allocate(1)) detail::shared_state<R&>(), D(a2, 1) );
+          // the shared state and its reference count are allocated as a single block
+          future_ = boost::allocate_shared<detail::shared_state<R&> >(a);
           future_obtained = false;
         }
 #endif
@@ -2389,6 +2762,7 @@ namespace boost
 
         future_ptr future_;
         bool future_obtained;
+        friend class detail::promise_batch_base<void>;
 
         void lazy_init()
         {
@@ -2407,11 +2781,8 @@ namespace boost
         template <class Allocator>
         promise(boost::allocator_arg_t, Allocator a)
         {
-          typedef typename Allocator::template rebind<detail::shared_state<void> >::other A2;
-          A2 a2(a);
-          typedef thread_detail::allocator_destructor<A2> D;
-
-          future_ = future_ptr(::new(a2.allocate(1)) detail::shared_state<void>(), D(a2, 1) );
+          // the shared state and its reference count are allocated as a single block
+          future_ = boost::allocate_shared<detail::shared_state<void> >(a);
           future_obtained = false;
         }
 #endif
@@ -2585,10 +2956,18 @@ namespace boost
                 started(false)
             {}
 
+            typedef boost::shared_ptr<task_base_shared_state> task_ptr;
+
+            /// makes the task runnable again, reusing this state. Only valid once nothing but its owner refers to it.
             void reset()
             {
+              boost::unique_lock<boost::mutex> lk(this->mutex);
               started=false;
+              this->clear_ready_state(lk);
             }
+            /// \b Returns: a new state for the same task, taking the callable from this one, which is then left to its
+            /// futures.
+            virtual task_ptr renew()=0;
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
             virtual void do_run(BOOST_THREAD_RV_REF(ArgTypes) ... args)=0;
             void run(BOOST_THREAD_RV_REF(ArgTypes) ... args)
@@ -2604,6 +2983,8 @@ namespace boost
                         boost::throw_exception(task_already_started());
                     }
                     started=true;
+                    // the task of a state made ready by a cancellation is dropped
+                    if(this->done) return;
                 }
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
                 do_run(boost::forward<ArgTypes>(args)...);
@@ -2627,6 +3008,7 @@ namespace boost
                         boost::throw_exception(task_already_started());
                     }
                     started=true;
+                    if(this->done) return;
                 }
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
                 do_apply(boost::forward<ArgTypes>(args)...);
@@ -2676,6 +3058,11 @@ namespace boost
               f(boost::move(f_))
             {}
 
+            typename task_shared_state::task_ptr renew()
+            {
+              return typename task_shared_state::task_ptr(new task_shared_state(boost::move(f)));
+            }
+
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
             void do_apply(BOOST_THREAD_RV_REF(ArgTypes) ... args)
             {
@@ -2763,6 +3150,11 @@ namespace boost
                 f(boost::move(f_))
             {}
 
+            typename task_shared_state::task_ptr renew()
+            {
+              return typename task_shared_state::task_ptr(new task_shared_state(boost::move(f)));
+            }
+
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
             void do_apply(BOOST_THREAD_RV_REF(ArgTypes) ... args)
             {
@@ -2852,6 +3244,11 @@ namespace boost
                 {}
 #endif
 
+                typename task_shared_state::task_ptr renew()
+                {
+                  return typename task_shared_state::task_ptr(new task_shared_state(f));
+                }
+
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
                 void do_apply(BOOST_THREAD_RV_REF(ArgTypes) ... args)
                 {
@@ -2940,7 +3337,12 @@ namespace boost
                 {}
 #endif
 
-#if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
+                typename task_shared_state::task_ptr renew()
+                {
+                  return typename task_shared_state::task_ptr(new task_shared_state(f));
+                }
+
+#if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
                 void do_apply(BOOST_THREAD_RV_REF(ArgTypes) ... args)
                 {
                     try
@@ -3023,6 +3425,11 @@ namespace boost
                 f(boost::move(f_))
             {}
 
+            typename task_shared_state::task_ptr renew()
+            {
+              return typename task_shared_state::task_ptr(new task_shared_state(boost::move(f)));
+            }
+
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
             void do_apply(BOOST_THREAD_RV_REF(ArgTypes) ... args)
             {
@@ -3102,6 +3509,11 @@ namespace boost
                 f(f_)
             {}
 
+            typename task_shared_state::task_ptr renew()
+            {
+              return typename task_shared_state::task_ptr(new task_shared_state(f));
+            }
+
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
             void do_apply(BOOST_THREAD_RV_REF(ArgTypes) ... args)
             {
@@ -3280,6 +3692,9 @@ namespace boost
 
         }
 #endif
+        // defined in <boost/thread/cancellation.hpp>
+        template <class F>
+        packaged_task(cancellation_token tk, BOOST_THREAD_FWD_REF(F) f);
 
 #if defined BOOST_THREAD_PROVIDES_FUTURE_CTOR_ALLOCATORS
 #if defined(BOOST_THREAD_RVALUE_REFERENCES_DONT_MATCH_FUNTION_PTR)
@@ -3402,7 +3817,17 @@ namespace boost
         void reset() {
             if (!valid())
                 throw future_error(system::make_error_code(future_errc::no_state));
-            task->reset();
+            if (task.unique())
+            {
+              // no future nor continuation refers to the state, so that it is made runnable again in place
+              task->reset();
+            }
+            else
+            {
+              task_ptr renewed(task->renew());
+              task->owner_destroyed();
+              task.swap(renewed);
+            }
             future_obtained=false;
         }
 
@@ -3559,7 +3984,11 @@ namespace detail
       packaged_task_type pt( f );
       BOOST_THREAD_FUTURE<R> ret = BOOST_THREAD_MAKE_RV_REF(pt.get_future());
       ret.set_async();
+#if defined BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR
+      executors::default_executor().submit(boost::move(pt));
+#else
       boost::thread( boost::move(pt) ).detach();
+#endif
       return ::boost::move(ret);
     } else if (underlying_cast<int>(policy) & int(launch::deferred)) {
       std::terminate();
@@ -3624,7 +4053,11 @@ namespace detail
       packaged_task_type pt( boost::forward<F>(f) );
       BOOST_THREAD_FUTURE<R> ret = pt.get_future();
       ret.set_async();
+#if defined BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR
+      executors::default_executor().submit(boost::move(pt));
+#else
       boost::thread( boost::move(pt) ).detach();
+#endif
       return ::boost::move(ret);
     } else if (underlying_cast<int>(policy) & int(launch::deferred)) {
       std::terminate();
@@ -3651,11 +4084,11 @@ namespace detail {
     template<typename Rp, typename Fp>
     struct shared_state_nullary_task
     {
-      shared_state<Rp>* that;
+      shared_ptr<shared_state<Rp> > that;
       Fp f_;
     public:
 
-      shared_state_nullary_task(shared_state<Rp>* st, BOOST_THREAD_FWD_REF(Fp) f)
+      shared_state_nullary_task(shared_ptr<shared_state<Rp> > const& st, BOOST_THREAD_FWD_REF(Fp) f)
       : that(st), f_(boost::forward<Fp>(f))
       {};
 #if ! defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
@@ -3675,19 +4108,21 @@ namespace detail {
       shared_state_nullary_task(BOOST_THREAD_RV_REF(shared_state_nullary_task) x) //BOOST_NOEXCEPT
       : that(x.that), f_(boost::move(x.f_))
       {
-        x.that=0;
+        x.that.reset();
       }
       shared_state_nullary_task& operator=(BOOST_THREAD_RV_REF(shared_state_nullary_task) x) //BOOST_NOEXCEPT
       {
         if (this != &x) {
           that=x.that;
           f_=boost::move(x.f_);
-          x.that=0;
+          x.that.reset();
         }
         return *this;
       }
 #endif
       void operator()() {
+        // the work of a state made ready by a cancellation is dropped before it runs
+        if (that->is_done()) return;
         try {
           that->mark_finished_with_result(f_());
 #if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
@@ -3704,10 +4139,10 @@ namespace detail {
     template<typename Fp>
     struct shared_state_nullary_task<void, Fp>
     {
-      shared_state<void>* that;
+      shared_ptr<shared_state<void> > that;
       Fp f_;
     public:
-      shared_state_nullary_task(shared_state<void>* st, BOOST_THREAD_FWD_REF(Fp) f)
+      shared_state_nullary_task(shared_ptr<shared_state<void> > const& st, BOOST_THREAD_FWD_REF(Fp) f)
       : that(st), f_(boost::forward<Fp>(f))
       {};
 #if ! defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
@@ -3727,18 +4162,19 @@ namespace detail {
       shared_state_nullary_task(BOOST_THREAD_RV_REF(shared_state_nullary_task) x) BOOST_NOEXCEPT
       : that(x.that), f_(boost::move(x.f_))
       {
-        x.that=0;
+        x.that.reset();
       }
       shared_state_nullary_task& operator=(BOOST_THREAD_RV_REF(shared_state_nullary_task) x) BOOST_NOEXCEPT {
         if (this != &x) {
           that=x.that;
           f_=boost::move(x.f_);
-          x.that=0;
+          x.that.reset();
         }
         return *this;
       }
 #endif
       void operator()() {
+        if (that->is_done()) return;
         try {
           f_();
           that->mark_finished_with_result();
@@ -3755,10 +4191,10 @@ namespace detail {
     template<typename Rp, typename Fp>
     struct shared_state_nullary_task<Rp&, Fp>
     {
-      shared_state<Rp&>* that;
+      shared_ptr<shared_state<Rp&> > that;
       Fp f_;
     public:
-      shared_state_nullary_task(shared_state<Rp&>* st, BOOST_THREAD_FWD_REF(Fp) f)
+      shared_state_nullary_task(shared_ptr<shared_state<Rp&> > const& st, BOOST_THREAD_FWD_REF(Fp) f)
         : that(st), f_(boost::forward<Fp>(f))
       {}
 #if ! defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
@@ -3777,18 +4213,19 @@ namespace detail {
       shared_state_nullary_task(BOOST_THREAD_RV_REF(shared_state_nullary_task) x) BOOST_NOEXCEPT
       : that(x.that), f_(boost::move(x.f_))
       {
-        x.that=0;
+        x.that.reset();
       }
       shared_state_nullary_task& operator=(BOOST_THREAD_RV_REF(shared_state_nullary_task) x) BOOST_NOEXCEPT {
         if (this != &x) {
           that=x.that;
           f_=boost::move(x.f_);
-          x.that=0;
+          x.that.reset();
         }
         return *this;
       }
 #endif
       void operator()() {
+        if (that->is_done()) return;
         try {
           that->mark_finished_with_result(f_());
 #if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
@@ -3808,17 +4245,17 @@ namespace detail {
     struct future_executor_shared_state: shared_state<Rp>
     {
       typedef shared_state<Rp> base_type;
-    protected:
     public:
-      template<typename Fp>
-      future_executor_shared_state(Executor& ex, BOOST_THREAD_FWD_REF(Fp) f) {
+      future_executor_shared_state() {
         this->set_executor();
-        shared_state_nullary_task<Rp,Fp> t(this, boost::forward<Fp>(f));
-        ex.submit(boost::move(t));
       }
 
-      ~future_executor_shared_state() {
-        this->wait(false);
+      /// submits the task once the state is owned by a shared_ptr, as the task shares it so that discarding the
+      /// future doesn't wait for the task: the executor tracks its completion instead.
+      template<typename Fp>
+      void init(Executor& ex, BOOST_THREAD_FWD_REF(Fp) f) {
+        shared_state_nullary_task<Rp,Fp> t(static_pointer_cast<base_type>(this->shared_from_this()), boost::forward<Fp>(f));
+        ex.submit(boost::move(t));
       }
     };
 
@@ -3829,7 +4266,8 @@ namespace detail {
     BOOST_THREAD_FUTURE<Rp>
     make_future_executor_shared_state(Executor& ex, BOOST_THREAD_FWD_REF(Fp) f) {
       shared_ptr<future_executor_shared_state<Rp, Executor> >
-          h(new future_executor_shared_state<Rp, Executor>(ex, boost::forward<Fp>(f)));
+          h(new future_executor_shared_state<Rp, Executor>());
+      h->init(ex, boost::forward<Fp>(f));
       return BOOST_THREAD_FUTURE<Rp>(h);
     }
 
@@ -4163,6 +4601,23 @@ namespace detail
   /// future_async_continuation_shared_state
   /////////////////////////
 
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+  /// runs a continuation on an executor, keeping its shared state alive until it has been run
+  template<typename State>
+  struct future_continuation_task
+  {
+    shared_ptr<State> that;
+  public:
+    explicit future_continuation_task(shared_ptr<State> st)
+    : that(st)
+    {}
+    void operator()()
+    {
+      State::run(that.get());
+    }
+  };
+#endif
+
   template<typename F, typename Rp, typename Fp>
   struct future_async_continuation_shared_state: future_async_shared_state_base<Rp>
   {
@@ -4175,10 +4630,19 @@ namespace detail
       continuation(boost::move(c)) {
     }
 
+#if defined BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR
+    void launch_continuation(boost::unique_lock<boost::mutex>& lk) {
+      future_continuation_task<future_async_continuation_shared_state> t(
+          static_pointer_cast<future_async_continuation_shared_state>(this->shared_from_this()));
+      // the parent is unlocked so that an executor running the continuation inline doesn't deadlock on it.
+      relocker relock(lk);
+      executors::default_executor().submit(t);
+    }
+#else
     void launch_continuation(boost::unique_lock<boost::mutex>& ) {
-      //lock.unlock();
       this->thr_ = thread(&future_async_continuation_shared_state::run, this);
     }
+#endif
 
     static void run(future_async_continuation_shared_state* that) {
       try {
@@ -4209,10 +4673,19 @@ namespace detail
       continuation(boost::move(c)) {
     }
 
+#if defined BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR
+    void launch_continuation(boost::unique_lock<boost::mutex>& lk) {
+      future_continuation_task<future_async_continuation_shared_state> t(
+          static_pointer_cast<future_async_continuation_shared_state>(this->shared_from_this()));
+      // the parent is unlocked so that an executor running the continuation inline doesn't deadlock on it.
+      relocker relock(lk);
+      executors::default_executor().submit(t);
+    }
+#else
     void launch_continuation(boost::unique_lock<boost::mutex>& ) {
-      //lk.unlock();
       this->thr_ = thread(&future_async_continuation_shared_state::run, this);
     }
+#endif
 
     static void run(future_async_continuation_shared_state* that) {
       try {
@@ -4324,6 +4797,283 @@ namespace detail
 
     return BOOST_THREAD_FUTURE<Rp>(h);
   }
+
+  /////////////////////////
+  /// future_sync_continuation_shared_state
+  /////////////////////////
+
+  /// runs the inline continuations of a chain one after the other in a single loop of the thread that made the first
+  /// one ready, instead of nesting each continuation in the completion of the previous one.
+  struct sync_continuation_runner
+  {
+    typedef shared_ptr<sync_continuation_runner> runner_ptr;
+
+    // whether the continuation is running in a loop, protected by the mutex of the state. The inline continuations
+    // launched meanwhile are queued and run next by the same loop.
+    bool running_;
+    std::vector<runner_ptr> queued_;
+
+    sync_continuation_runner() : running_(false) {}
+    virtual ~sync_continuation_runner() {}
+
+    /// runs the continuation, makes the state ready and moves the inline continuations it launched to next.
+    virtual void run_and_collect(std::vector<runner_ptr>& next) = 0;
+
+    /// Requires: the mutex of parent is locked.
+    /// Effects: queues r to the loop running the continuation of parent, if any.
+    static bool queue_to_running(shared_state_base* parent, runner_ptr r)
+    {
+      sync_continuation_runner* p = parent->as_sync_runner();
+      if (p && p->running_)
+      {
+        p->queued_.push_back(r);
+        return true;
+      }
+      return false;
+    }
+
+    /// Effects: Runs r and the inline continuations that become ready meanwhile in the calling thread.
+    static void run_chain(runner_ptr r)
+    {
+      std::vector<runner_ptr> pending;
+      pending.push_back(r);
+      while (! pending.empty())
+      {
+        runner_ptr current = pending.back();
+        pending.pop_back();
+        current->run_and_collect(pending);
+      }
+    }
+
+  protected:
+    /// Requires: the mutex of the state is locked.
+    void collect(std::vector<runner_ptr>& next)
+    {
+      running_ = false;
+      // the first queued continuation is run first.
+      next.insert(next.end(), queued_.rbegin(), queued_.rend());
+      queued_.clear();
+    }
+  };
+
+  template<typename F, typename Rp, typename Fp>
+  struct future_sync_continuation_shared_state: shared_state<Rp>, sync_continuation_runner
+  {
+    F parent;
+    Fp continuation;
+    shared_ptr<shared_state_base> parent_state_;
+
+  public:
+    future_sync_continuation_shared_state(BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c)
+    : parent(boost::move(f)),
+      continuation(boost::move(c)) {
+      this->set_sync();
+    }
+
+    virtual sync_continuation_runner* as_sync_runner() {
+      return this;
+    }
+
+    virtual void launch_continuation(boost::unique_lock<boost::mutex>& lk) {
+      runner_ptr self(this->shared_from_this(), static_cast<sync_continuation_runner*>(this));
+      if (! queue_to_running(parent.future_.get(), self)) {
+        // the thread making the parent ready may not own it, so it must not be released before it is relocked.
+        this->parent_state_ = parent.future_;
+        relocker relock(lk);
+        run_chain(self);
+      }
+    }
+
+    virtual void run_and_collect(std::vector<runner_ptr>& next) {
+      boost::unique_lock<boost::mutex> lck(this->mutex);
+      this->running_ = true;
+      try {
+        Fp local_fuct=boost::move(continuation);
+        F ftmp = boost::move(parent);
+        relocker relock(lck);
+        Rp res = local_fuct(boost::move(ftmp));
+        relock.lock();
+        this->mark_finished_with_result_internal(boost::move(res), lck);
+      } catch (...) {
+        this->mark_exceptional_finish_internal(current_exception(), lck);
+      }
+      this->collect(next);
+    }
+  };
+
+  template<typename F, typename Fp>
+  struct future_sync_continuation_shared_state<F,void,Fp>: shared_state<void>, sync_continuation_runner
+  {
+    F parent;
+    Fp continuation;
+    shared_ptr<shared_state_base> parent_state_;
+
+  public:
+    future_sync_continuation_shared_state(BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c)
+    : parent(boost::move(f)),
+      continuation(boost::move(c)) {
+      this->set_sync();
+    }
+
+    virtual sync_continuation_runner* as_sync_runner() {
+      return this;
+    }
+
+    virtual void launch_continuation(boost::unique_lock<boost::mutex>& lk) {
+      runner_ptr self(this->shared_from_this(), static_cast<sync_continuation_runner*>(this));
+      if (! queue_to_running(parent.future_.get(), self)) {
+        // the thread making the parent ready may not own it, so it must not be released before it is relocked.
+        this->parent_state_ = parent.future_;
+        relocker relock(lk);
+        run_chain(self);
+      }
+    }
+
+    virtual void run_and_collect(std::vector<runner_ptr>& next) {
+      boost::unique_lock<boost::mutex> lck(this->mutex);
+      this->running_ = true;
+      try {
+        Fp local_fuct=boost::move(continuation);
+        F ftmp = boost::move(parent);
+        relocker relock(lck);
+        local_fuct(boost::move(ftmp));
+        relock.lock();
+        this->mark_finished_with_result_internal(lck);
+      } catch (...) {
+        this->mark_exceptional_finish_internal(current_exception(), lck);
+      }
+      this->collect(next);
+    }
+  };
+
+  ////////////////////////////////
+  // make_future_sync_continuation_shared_state
+  ////////////////////////////////
+  template<typename F, typename Rp, typename Fp>
+  BOOST_THREAD_FUTURE<Rp>
+  make_future_sync_continuation_shared_state(
+      boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f,
+      BOOST_THREAD_FWD_REF(Fp) c) {
+    shared_ptr<future_sync_continuation_shared_state<F,Rp, Fp> >
+        h(new future_sync_continuation_shared_state<F,Rp, Fp>(boost::move(f), boost::forward<Fp>(c)));
+    // keeps the parent alive until it is unlocked, as the continuation of a ready parent releases it at once.
+    shared_ptr<shared_state_base> parent_state(h->parent.future_);
+    if (parent_state->is_deferred_) {
+      parent_state->wait_internal(lock, false);
+    }
+    if (parent_state->done) {
+      lock.unlock();
+      sync_continuation_runner::run_chain(sync_continuation_runner::runner_ptr(h, h.get()));
+    } else {
+      parent_state->set_continuation_ptr(h, lock);
+    }
+
+    return BOOST_THREAD_FUTURE<Rp>(h);
+  }
+
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+  /////////////////////////
+  /// future_executor_continuation_shared_state
+  /////////////////////////
+
+  template<typename Ex, typename F, typename Rp, typename Fp>
+  struct future_executor_continuation_shared_state: shared_state<Rp>
+  {
+    Ex* ex;
+    F parent;
+    Fp continuation;
+
+  public:
+    future_executor_continuation_shared_state(Ex& e, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c)
+    : ex(&e),
+      parent(boost::move(f)),
+      continuation(boost::move(c)) {
+      this->set_executor();
+    }
+
+    void launch_continuation(boost::unique_lock<boost::mutex>& lk) {
+      future_continuation_task<future_executor_continuation_shared_state> t(
+          static_pointer_cast<future_executor_continuation_shared_state>(this->shared_from_this()));
+      // the parent is unlocked so that an executor running the continuation inline doesn't deadlock on it.
+      relocker relock(lk);
+      try {
+        ex->submit(t);
+      } catch(...) {
+        // the executor is closed, the continuation will never run
+        this->mark_exceptional_finish();
+      }
+    }
+
+    static void run(future_executor_continuation_shared_state* that) {
+      try {
+        that->mark_finished_with_result(that->continuation(boost::move(that->parent)));
+#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
+      } catch(thread_interrupted& ) {
+        that->mark_interrupted_finish();
+#endif
+      } catch(...) {
+        that->mark_exceptional_finish();
+      }
+    }
+  };
+
+  template<typename Ex, typename F, typename Fp>
+  struct future_executor_continuation_shared_state<Ex, F, void, Fp>: shared_state<void>
+  {
+    Ex* ex;
+    F parent;
+    Fp continuation;
+
+  public:
+    future_executor_continuation_shared_state(Ex& e, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c)
+    : ex(&e),
+      parent(boost::move(f)),
+      continuation(boost::move(c)) {
+      this->set_executor();
+    }
+
+    void launch_continuation(boost::unique_lock<boost::mutex>& lk) {
+      future_continuation_task<future_executor_continuation_shared_state> t(
+          static_pointer_cast<future_executor_continuation_shared_state>(this->shared_from_this()));
+      // the parent is unlocked so that an executor running the continuation inline doesn't deadlock on it.
+      relocker relock(lk);
+      try {
+        ex->submit(t);
+      } catch(...) {
+        // the executor is closed, the continuation will never run
+        this->mark_exceptional_finish();
+      }
+    }
+
+    static void run(future_executor_continuation_shared_state* that) {
+      try {
+        that->continuation(boost::move(that->parent));
+        that->mark_finished_with_result();
+#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
+      } catch(thread_interrupted& ) {
+        that->mark_interrupted_finish();
+#endif
+      } catch(...) {
+        that->mark_exceptional_finish();
+      }
+    }
+  };
+
+  ////////////////////////////////
+  // make_future_executor_continuation_shared_state
+  ////////////////////////////////
+  template<typename Ex, typename F, typename Rp, typename Fp>
+  BOOST_THREAD_FUTURE<Rp>
+  make_future_executor_continuation_shared_state(Ex& ex,
+      boost::unique_lock<boost::mutex> &lock, BOOST_THREAD_RV_REF(F) f,
+      BOOST_THREAD_FWD_REF(Fp) c) {
+    shared_ptr<future_executor_continuation_shared_state<Ex, F, Rp, Fp> >
+        h(new future_executor_continuation_shared_state<Ex, F, Rp, Fp>(ex, boost::move(f), boost::forward<Fp>(c)));
+    h->parent.future_->set_continuation_ptr(h, lock);
+
+    return BOOST_THREAD_FUTURE<Rp>(h);
+  }
+#endif
 }
 
   ////////////////////////////////
@@ -4347,6 +5097,10 @@ namespace detail
       return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_deferred_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type, F>(
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
+    } else if (underlying_cast<int>(policy) & int(launch::sync)) {
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_sync_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type, F>(
+                  lock, boost::move(*this), boost::forward<F>(func)
+              )));
     } else {
       return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type, F>(
                   lock, boost::move(*this), boost::forward<F>(func)
@@ -4354,6 +5108,25 @@ namespace detail
     }
   }
 
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+  ////////////////////////////////
+  // template<typename Ex, typename F>
+  // auto future<R>::then(Ex& ex, F&& func) -> BOOST_THREAD_FUTURE<decltype(func(*this))>;
+  ////////////////////////////////
+  template <typename R>
+  template <typename Ex, typename F>
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type>
+  BOOST_THREAD_FUTURE<R>::then(Ex& ex, BOOST_THREAD_FWD_REF(F) func) {
+    typedef typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type future_type;
+    BOOST_THREAD_ASSERT_PRECONDITION(this->future_!=0, future_uninitialized());
+
+    boost::unique_lock<boost::mutex> lock(this->future_->mutex);
+    return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_continuation_shared_state<Ex, BOOST_THREAD_FUTURE<R>, future_type, F>(ex,
+                lock, boost::move(*this), boost::forward<F>(func)
+            )));
+  }
+#endif
+
   template <typename R>
   template <typename F>
   inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<R>)>::type>
@@ -4371,6 +5144,10 @@ namespace detail
       return boost::detail::make_future_deferred_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type, F>(
           lock, boost::move(*this), boost::forward<F>(func)
       );
+    } else if (underlying_cast<int>(this->launch_policy(lock)) & int(launch::sync)) {
+      return boost::detail::make_future_sync_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type, F>(
+          lock, boost::move(*this), boost::forward<F>(func)
+      );
     } else {
       return boost::detail::make_future_async_continuation_shared_state<BOOST_THREAD_FUTURE<R>, future_type, F>(
           lock, boost::move(*this), boost::forward<F>(func)
@@ -4449,6 +5226,10 @@ namespace detail
       return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_deferred_continuation_shared_state<shared_future<R>, future_type, F>(
                   lock, boost::move(*this), boost::forward<F>(func)
               )));
+    } else if (underlying_cast<int>(policy) & int(launch::sync)) {
+      return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_sync_continuation_shared_state<shared_future<R>, future_type, F>(
+                  lock, boost::move(*this), boost::forward<F>(func)
+              )));
     } else {
       return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_async_continuation_shared_state<shared_future<R>, future_type, F>(
                   lock, boost::move(*this), boost::forward<F>(func)
@@ -4456,6 +5237,22 @@ namespace detail
     }
   }
 
+#ifdef BOOST_THREAD_PROVIDES_EXECUTORS
+  template <typename R>
+  template <typename Ex, typename F>
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future<R>)>::type>
+  shared_future<R>::then(Ex& ex, BOOST_THREAD_FWD_REF(F) func)
+  {
+    typedef typename boost::result_of<F(shared_future<R>)>::type future_type;
+    BOOST_THREAD_ASSERT_PRECONDITION(this->future_!=0, future_uninitialized());
+
+    boost::unique_lock<boost::mutex> lock(this->future_->mutex);
+    return BOOST_THREAD_MAKE_RV_REF((boost::detail::make_future_executor_continuation_shared_state<Ex, shared_future<R>, future_type, F>(ex,
+                lock, boost::move(*this), boost::forward<F>(func)
+            )));
+  }
+#endif
+
   template <typename R>
   template <typename F>
   inline BOOST_THREAD_FUTURE<typename boost::result_of<F(shared_future<R>)>::type>
@@ -4472,6 +5269,9 @@ namespace detail
       this->future_->wait_internal(lock);
       return boost::detail::make_future_deferred_continuation_shared_state<shared_future<R>, future_type, F>(
           lock, boost::move(*this), boost::forward<F>(func));
+    } else if (underlying_cast<int>(this->launch_policy(lock)) & int(launch::sync)) {
+      return boost::detail::make_future_sync_continuation_shared_state<shared_future<R>, future_type, F>(
+          lock, boost::move(*this), boost::forward<F>(func));
     } else {
       return boost::detail::make_future_async_continuation_shared_state<shared_future<R>, future_type, F>(
           lock, boost::move(*this), boost::forward<F>(func));
@@ -4588,143 +5388,240 @@ namespace detail
   BOOST_CONSTEXPR_OR_CONST input_iterator_tag input_iterator_tag_value = {};
   BOOST_CONSTEXPR_OR_CONST vector_tag vector_tag_value = {};
   BOOST_CONSTEXPR_OR_CONST values_tag values_tag_value = {};
+
   ////////////////////////////////
-  // detail::future_async_when_all_shared_state
+  // detail::for_each_future
   ////////////////////////////////
-  template<typename F>
-  struct future_when_all_vector_shared_state: future_async_shared_state_base<csbl::vector<F> >
+  template<typename F, typename Fn>
+  void for_each_future(csbl::vector<F>& futures, Fn& fn)
   {
-    typedef csbl::vector<F> vector_type;
-    typedef typename F::value_type value_type;
-    csbl::vector<F> vec_;
-
-    static void run(future_when_all_vector_shared_state* that) {
-      try {
-        boost::wait_for_all(that->vec_.begin(), that->vec_.end());
-        that->mark_finished_with_result(boost::move(that->vec_));
-#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
-      } catch(thread_interrupted& ) {
-        that->mark_interrupted_finish();
+    for (typename csbl::vector<F>::iterator it = futures.begin(); it != futures.end(); ++it)
+    {
+      fn(*it);
+    }
+  }
+#if ! defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+  template<std::size_t I, std::size_t N>
+  struct for_each_tuple_future
+  {
+    template<typename Tuple, typename Fn>
+    static void apply(Tuple& futures, Fn& fn)
+    {
+      fn(csbl::get<I>(futures));
+      for_each_tuple_future<I+1, N>::apply(futures, fn);
+    }
+  };
+  template<std::size_t N>
+  struct for_each_tuple_future<N, N>
+  {
+    template<typename Tuple, typename Fn>
+    static void apply(Tuple&, Fn&) {}
+  };
+  template<typename ...F, typename Fn>
+  void for_each_future(csbl::tuple<F...>& futures, Fn& fn)
+  {
+    for_each_tuple_future<0, sizeof...(F)>::apply(futures, fn);
+  }
 #endif
-      } catch(...) {
-        that->mark_exceptional_finish();
+
+  ////////////////////////////////
+  // detail::future_when_shared_state
+  //
+  // Owns the futures and registers itself as a continuation of each of their shared states, so that it is made ready
+  // by the continuation of the last future (when_all) or of the first one (when_any) to become ready.
+  // No thread waits for the futures and their mutexes are never locked all together.
+  ////////////////////////////////
+  template<typename Container, bool Any>
+  struct future_when_shared_state: shared_state<Container>
+  {
+    Container futures_;
+    // the continuations that must still be launched before being ready, plus one while they are being registered.
+    boost::atomic<std::size_t> pending_;
+    // when_any: whether a continuation has already been launched.
+    boost::atomic<bool> any_ready_;
+    // the shared states of the deferred futures, that are run when this state is waited for.
+    csbl::vector<shared_ptr<shared_state_base> > deferred_;
+
+    struct registrar
+    {
+      shared_ptr<shared_state_base> that_;
+      future_when_shared_state* self_;
+
+      template<typename F>
+      void operator()(F& f)
+      {
+        if (Any && self_->any_ready_.load(boost::memory_order_acquire))
+        {
+          return;
+        }
+        // as for wait_for_all and wait_for_any, a future without shared state is considered ready.
+        if (! f.future_)
+        {
+          if (Any) self_->notify_ready();
+          return;
+        }
+        boost::unique_lock<boost::mutex> lock(f.future_->mutex);
+        if (f.future_->is_deferred_)
+        {
+          self_->deferred_.push_back(f.future_);
+        }
+        if (! Any)
+        {
+          self_->pending_.fetch_add(1, boost::memory_order_relaxed);
+        }
+        f.future_->set_continuation_ptr(that_, lock);
       }
-    }
-    void init() {
-      this->thr_ = thread(&future_when_all_vector_shared_state::run, this);
+    };
+
+    explicit future_when_shared_state(BOOST_THREAD_RV_REF(Container) futures)
+    : futures_(boost::move(futures)),
+      pending_(Any ? 2 : 1),
+      any_ready_(false)
+    {
     }
 
-  public:
-    template< typename InputIterator>
-    future_when_all_vector_shared_state(input_iterator_tag, InputIterator first, InputIterator last)
-    : vec_(std::make_move_iterator(first), std::make_move_iterator(last))
+    /// Registers the continuations. \c that shall own this.
+    void init(shared_ptr<shared_state_base> const& that)
     {
-      init();
+      registrar r = { that, this };
+      for_each_future(futures_, r);
+      if (! deferred_.empty())
+      {
+        this->set_deferred();
+      }
+      release();
     }
 
-    future_when_all_vector_shared_state(vector_tag, BOOST_THREAD_RV_REF(csbl::vector<F>) v)
-    : vec_(boost::move(v))
+    void release()
     {
-      init();
+      if (pending_.fetch_sub(1, boost::memory_order_acq_rel) == 1)
+      {
+        this->mark_finished_with_result(boost::move(futures_));
+      }
     }
 
-#if ! defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
-    template< typename T0, typename ...T>
-    future_when_all_vector_shared_state(values_tag, BOOST_THREAD_RV_REF(T0) f, BOOST_THREAD_RV_REF(T) ... futures) {
-      vec_.push_back(boost::forward<T0>(f));
-      typename alias_t<char[]>::type{
-          ( //first part of magic unpacker
-          vec_.push_back(boost::forward<T>(futures)),'0'
-          )..., '0'
-      }; //second part of magic unpacker
-      init();
+    void notify_ready()
+    {
+      if (! Any || ! any_ready_.exchange(true, boost::memory_order_acq_rel))
+      {
+        release();
+      }
     }
-#else
-#endif
-    ~future_when_all_vector_shared_state() {
-      this->join();
+
+    // called with the lock of the shared state of one of the futures.
+    virtual void launch_continuation(boost::unique_lock<boost::mutex>&)
+    {
+      notify_ready();
     }
 
+    // runs the deferred futures, all of them for when_all and the first one for when_any, and waits to be ready.
+    virtual void execute(boost::unique_lock<boost::mutex>& lk)
+    {
+      csbl::vector<shared_ptr<shared_state_base> > deferred;
+      deferred.swap(deferred_);
+      {
+        relocker relock(lk);
+        for (typename csbl::vector<shared_ptr<shared_state_base> >::iterator it = deferred.begin();
+            it != deferred.end(); ++it)
+        {
+          if (Any && any_ready_.load(boost::memory_order_acquire))
+          {
+            break;
+          }
+          (*it)->wait(false);
+        }
+      }
+      while (! this->done)
+      {
+        this->waiters.wait(lk);
+      }
+    }
   };
 
   ////////////////////////////////
-  // detail::future_async_when_any_shared_state
+  // detail::future_when_all_vector_shared_state
   ////////////////////////////////
   template<typename F>
-  struct future_when_any_vector_shared_state: future_async_shared_state_base<csbl::vector<F> >
+  struct future_when_all_vector_shared_state: future_when_shared_state<csbl::vector<F>, false>
   {
+    typedef future_when_shared_state<csbl::vector<F>, false> base_type;
     typedef csbl::vector<F> vector_type;
     typedef typename F::value_type value_type;
-    csbl::vector<F> vec_;
 
-    static void run(future_when_any_vector_shared_state* that)
+    template< typename InputIterator>
+    future_when_all_vector_shared_state(input_iterator_tag, InputIterator first, InputIterator last)
+    : base_type(vector_type(std::make_move_iterator(first), std::make_move_iterator(last)))
     {
-      try {
-        boost::wait_for_any(that->vec_.begin(), that->vec_.end());
-        that->mark_finished_with_result(boost::move(that->vec_));
-#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
-      } catch(thread_interrupted& ) {
-        that->mark_interrupted_finish();
-#endif
-      } catch(...) {
-        that->mark_exceptional_finish();
-      }
     }
-    void init() {
-      this->thr_ = thread(&future_when_any_vector_shared_state::run, this);
+
+    future_when_all_vector_shared_state(vector_tag, BOOST_THREAD_RV_REF(vector_type) v)
+    : base_type(boost::move(v))
+    {
     }
+  };
+
+  ////////////////////////////////
+  // detail::future_when_any_vector_shared_state
+  ////////////////////////////////
+  template<typename F>
+  struct future_when_any_vector_shared_state: future_when_shared_state<csbl::vector<F>, true>
+  {
+    typedef future_when_shared_state<csbl::vector<F>, true> base_type;
+    typedef csbl::vector<F> vector_type;
+    typedef typename F::value_type value_type;
 
-  public:
     template< typename InputIterator>
     future_when_any_vector_shared_state(input_iterator_tag, InputIterator first, InputIterator last)
-    : vec_(std::make_move_iterator(first), std::make_move_iterator(last))
+    : base_type(vector_type(std::make_move_iterator(first), std::make_move_iterator(last)))
     {
-      init();
     }
 
-    future_when_any_vector_shared_state(vector_tag, BOOST_THREAD_RV_REF(csbl::vector<F>) v)
-    : vec_(boost::move(v))
+    future_when_any_vector_shared_state(vector_tag, BOOST_THREAD_RV_REF(vector_type) v)
+    : base_type(boost::move(v))
     {
-      init();
-    }
-
-#if ! defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
-    template< typename T0, typename ...T>
-    future_when_any_vector_shared_state(values_tag,
-        BOOST_THREAD_RV_REF(T0) f, BOOST_THREAD_RV_REF(T) ... futures
-    ) {
-      vec_.push_back(boost::forward<T0>(f));
-      typename alias_t<char[]>::type{
-          ( //first part of magic unpacker
-          vec_.push_back(boost::forward<T>(futures))
-          ,'0'
-          )...,
-          '0'
-      }; //second part of magic unpacker
-      init();
-    }
-#endif
-
-    ~future_when_any_vector_shared_state()    {
-      this->join();
     }
-
   };
 
 #if ! defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+  template< typename F, typename ...T>
+  csbl::vector<F> make_future_vector(BOOST_THREAD_RV_REF(T) ... futures)
+  {
+    csbl::vector<F> v;
+    v.reserve(sizeof...(T));
+    typename alias_t<char[]>::type{
+        ( //first part of magic unpacker
+        v.push_back(boost::forward<T>(futures)),'0'
+        )..., '0'
+    }; //second part of magic unpacker
+    return boost::move(v);
+  }
+
 //#if ! defined(BOOST_NO_CXX11_HDR_TUPLE)
   template< typename T0, typename ...T>
-  struct future_when_all_tuple_shared_state: future_async_shared_state_base<
-    csbl::tuple<BOOST_THREAD_FUTURE<typename T0::value_type>, BOOST_THREAD_FUTURE<typename T::value_type>... >
+  struct future_when_all_tuple_shared_state: future_when_shared_state<
+    csbl::tuple<typename decay<T0>::type, typename decay<T>::type...>, false
   >
   {
+    typedef csbl::tuple<typename decay<T0>::type, typename decay<T>::type...> tuple_type;
+    typedef future_when_shared_state<tuple_type, false> base_type;
 
+    future_when_all_tuple_shared_state(values_tag, BOOST_THREAD_RV_REF(T0) f, BOOST_THREAD_RV_REF(T) ... futures)
+    : base_type(tuple_type(boost::forward<T0>(f), boost::forward<T>(futures)...))
+    {
+    }
   };
   template< typename T0, typename ...T>
-  struct future_when_any_tuple_shared_state: future_async_shared_state_base<
-    csbl::tuple<BOOST_THREAD_FUTURE<typename T0::value_type>, BOOST_THREAD_FUTURE<typename T::value_type>... >
+  struct future_when_any_tuple_shared_state: future_when_shared_state<
+    csbl::tuple<typename decay<T0>::type, typename decay<T>::type...>, true
   >
   {
+    typedef csbl::tuple<typename decay<T0>::type, typename decay<T>::type...> tuple_type;
+    typedef future_when_shared_state<tuple_type, true> base_type;
+
+    future_when_any_tuple_shared_state(values_tag, BOOST_THREAD_RV_REF(T0) f, BOOST_THREAD_RV_REF(T) ... futures)
+    : base_type(tuple_type(boost::forward<T0>(f), boost::forward<T>(futures)...))
+    {
+    }
   };
 //#endif
 #endif
@@ -4747,19 +5644,32 @@ namespace detail
     typedef typename container_type::value_type value_type;
     typedef detail::future_when_all_vector_shared_state<value_type> factory_all_type;
     typedef detail::future_when_any_vector_shared_state<value_type> factory_any_type;
+
+    template <typename Factory>
+    static shared_ptr<Factory> make(BOOST_THREAD_RV_REF(T0) f, BOOST_THREAD_RV_REF(T) ... futures)
+    {
+      return shared_ptr<Factory>(new Factory(vector_tag_value,
+          make_future_vector<value_type, T0, T...>(boost::forward<T0>(f), boost::forward<T>(futures)...)));
+    }
   };
 //#if ! defined(BOOST_NO_CXX11_HDR_TUPLE)
   template< typename T0, typename ...T>
   struct when_type_impl<false, T0, T...>
   {
-    typedef csbl::tuple<BOOST_THREAD_FUTURE<typename T0::value_type>, BOOST_THREAD_FUTURE<typename T::value_type>... > container_type;
+    typedef csbl::tuple<typename decay<T0>::type, typename decay<T>::type... > container_type;
     typedef detail::future_when_all_tuple_shared_state<T0, T...> factory_all_type;
     typedef detail::future_when_any_tuple_shared_state<T0, T...> factory_any_type;
+
+    template <typename Factory>
+    static shared_ptr<Factory> make(BOOST_THREAD_RV_REF(T0) f, BOOST_THREAD_RV_REF(T) ... futures)
+    {
+      return shared_ptr<Factory>(new Factory(values_tag_value, boost::forward<T0>(f), boost::forward<T>(futures)...));
+    }
   };
 //#endif
 
   template< typename T0, typename ...T>
-  struct when_type : when_type_impl<are_same<T0, T...>::value, T0, T...> {};
+  struct when_type : when_type_impl<are_same<typename decay<T0>::type, typename decay<T>::type...>::value, T0, T...> {};
 #endif
 }
 
@@ -4774,12 +5684,13 @@ namespace detail
 
     if (first==last) return make_ready_future(container_type());
     shared_ptr<factory_type >
-        h(new factory_type>(detail::input_iterator_tag_value, first,last));
+        h(new factory_type(detail::input_iterator_tag_value, first,last));
+    h->init(h);
     return BOOST_THREAD_FUTURE<container_type>(h);
   }
 
 //#if ! defined(BOOST_NO_CXX11_HDR_TUPLE)
-  BOOST_THREAD_FUTURE<csbl::tuple<> > when_all() {
+  inline BOOST_THREAD_FUTURE<csbl::tuple<> > when_all() {
     return make_ready_future(csbl::tuple<>());
   }
 //#endif
@@ -4792,7 +5703,8 @@ namespace detail
     typedef  typename detail::when_type<T0, T...>::factory_all_type factory_type;
 
     shared_ptr<factory_type>
-        h(new factory_type(detail::values_tag_value, boost::forward<T0>(f), boost::forward<T>(futures)...));
+        h(detail::when_type<T0, T...>::template make<factory_type>(boost::forward<T0>(f), boost::forward<T>(futures)...));
+    h->init(h);
     return BOOST_THREAD_FUTURE<container_type>(h);
   }
 #endif
@@ -4808,12 +5720,13 @@ namespace detail
 
     if (first==last) return make_ready_future(container_type());
     shared_ptr<factory_type >
-        h(new factory_type>(detail::input_iterator_tag_value, first,last));
+        h(new factory_type(detail::input_iterator_tag_value, first,last));
+    h->init(h);
     return BOOST_THREAD_FUTURE<container_type>(h);
   }
 
 //#if ! defined(BOOST_NO_CXX11_HDR_TUPLE)
-  BOOST_THREAD_FUTURE<csbl::tuple<> > when_any() {
+  inline BOOST_THREAD_FUTURE<csbl::tuple<> > when_any() {
     return make_ready_future(csbl::tuple<>());
   }
 //#endif
@@ -4826,7 +5739,8 @@ namespace detail
     typedef  typename detail::when_type<T0, T...>::factory_any_type factory_type;
 
     shared_ptr<factory_type>
-        h(new factory_type(detail::values_tag_value, boost::forward<T0>(f), boost::forward<T>(futures)...));
+        h(detail::when_type<T0, T...>::template make<factory_type>(boost::forward<T0>(f), boost::forward<T>(futures)...));
+    h->init(h);
     return BOOST_THREAD_FUTURE<container_type>(h);
   }
 #endif
@@ -0,0 +1,404 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_FUTURE_COROUTINE_HPP
+#define BOOST_THREAD_FUTURE_COROUTINE_HPP
+
+#include <boost/thread/detail/config.hpp>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_COROUTINES
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/executors/default_executor.hpp>
+
+#include <coroutine>
+#include <type_traits>
+#include <utility>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace detail
+{
+  /// the closure resuming a suspended coroutine.
+  struct coroutine_resumer
+  {
+    std::coroutine_handle<> h_;
+    void operator()()
+    {
+      h_.resume();
+    }
+  };
+
+  /// a reference to an executor of any type, used to resume the coroutines, or to the default executor.
+  class coroutine_executor_ref
+  {
+    void* ex_;
+    void (*submit_)(void*, std::coroutine_handle<>);
+
+    template <typename Ex>
+    static void submit_to(void* ex, std::coroutine_handle<> h)
+    {
+      coroutine_resumer r = { h };
+      static_cast<Ex*>(ex)->submit(r);
+    }
+  public:
+    coroutine_executor_ref() : ex_(0), submit_(&submit_to<executors::executor>) {}
+    template <typename Ex>
+    explicit coroutine_executor_ref(Ex& ex,
+        typename disable_if<is_same<Ex, coroutine_executor_ref>, int>::type = 0) : ex_(&ex), submit_(&submit_to<Ex>) {}
+
+    /**
+     * \b Effects: Submits the resumption of \c h to the executor. If the executor refuses it, e.g. because it is
+     * closed, \c h is resumed on the calling thread, so that the coroutine is neither leaked nor given a thread of its
+     * own.
+     */
+    void resume(std::coroutine_handle<> h) const
+    {
+      try
+      {
+        submit_(ex_ ? ex_ : &executors::default_executor(), h);
+        return;
+      }
+      catch (...)
+      {
+      }
+      h.resume();
+    }
+  };
+
+  /// the continuation of a future awaited by a coroutine, resuming it on an executor.
+  struct future_resume_shared_state: shared_state_base
+  {
+    coroutine_executor_ref ex_;
+    std::coroutine_handle<> h_;
+
+    future_resume_shared_state(coroutine_executor_ref ex, std::coroutine_handle<> h) : ex_(ex), h_(h) {}
+
+    virtual void launch_continuation(boost::unique_lock<boost::mutex>& lk)
+    {
+      relocker relock(lk);
+      ex_.resume(h_);
+    }
+  };
+
+  /// the awaiter of a future, moved or copied in the coroutine frame.
+  template <typename Future>
+  class future_awaiter
+  {
+    Future f_;
+    coroutine_executor_ref ex_;
+  public:
+    future_awaiter(BOOST_THREAD_RV_REF(Future) f, coroutine_executor_ref ex) : f_(boost::move(f)), ex_(ex) {}
+
+    bool await_ready()
+    {
+      BOOST_THREAD_ASSERT_PRECONDITION(f_.valid(), future_uninitialized());
+      return f_.is_ready();
+    }
+
+    /// registers the resumption of the coroutine as continuation of the shared state, unless it is ready or deferred.
+    bool await_suspend(std::coroutine_handle<> h)
+    {
+      // keeps the shared state alive until its mutex is unlocked, as the coroutine can be resumed and destroy the future
+      // as soon as the continuation is registered.
+      shared_ptr<shared_state_base> state = f_.future_;
+      shared_ptr<shared_state_base> resume(new future_resume_shared_state(ex_, h));
+      boost::unique_lock<boost::mutex> lk(state->mutex);
+      if (state->done || state->is_deferred_)
+      {
+        return false;
+      }
+      state->set_continuation_ptr(resume, lk);
+      return true;
+    }
+
+    decltype(std::declval<Future&>().get()) await_resume()
+    {
+      return f_.get();
+    }
+  };
+}
+
+  /**
+   * \b Returns: an awaitable that suspends the calling coroutine until \c f is ready, resumes it on \c ex and returns
+   * the result of \c f.get().
+   *
+   * \b Notes: A deferred future is run in the calling coroutine.
+   */
+  template <typename Ex, typename R>
+  detail::future_awaiter<BOOST_THREAD_FUTURE<R> > resume_on(Ex& ex, BOOST_THREAD_RV_REF(BOOST_THREAD_FUTURE<R>) f)
+  {
+    return detail::future_awaiter<BOOST_THREAD_FUTURE<R> >(boost::move(f), detail::coroutine_executor_ref(ex));
+  }
+  template <typename Ex, typename R>
+  detail::future_awaiter<shared_future<R> > resume_on(Ex& ex, shared_future<R> f)
+  {
+    return detail::future_awaiter<shared_future<R> >(boost::move(f), detail::coroutine_executor_ref(ex));
+  }
+
+  /**
+   * \b Effects: Suspends the calling coroutine until \c f is ready and resumes it on the default executor, or on the
+   * executor of the calling \c task.
+   */
+  template <typename R>
+  detail::future_awaiter<BOOST_THREAD_FUTURE<R> > operator co_await(BOOST_THREAD_RV_REF(BOOST_THREAD_FUTURE<R>) f)
+  {
+    return detail::future_awaiter<BOOST_THREAD_FUTURE<R> >(boost::move(f), detail::coroutine_executor_ref());
+  }
+  template <typename R>
+  detail::future_awaiter<shared_future<R> > operator co_await(shared_future<R> const& f)
+  {
+    return detail::future_awaiter<shared_future<R> >(shared_future<R>(f), detail::coroutine_executor_ref());
+  }
+
+  template <typename T>
+  class task;
+
+namespace detail
+{
+  template <typename T>
+  struct is_awaited_future : false_type {};
+  template <typename R>
+  struct is_awaited_future<BOOST_THREAD_FUTURE<R> > : true_type {};
+  template <typename R>
+  struct is_awaited_future<shared_future<R> > : true_type {};
+  template <typename T>
+  struct is_unique_awaited_future : false_type {};
+  template <typename R>
+  struct is_unique_awaited_future<BOOST_THREAD_FUTURE<R> > : true_type {};
+
+  /// the part of the promise of a task that doesn't depend on its result type.
+  struct task_promise_base
+  {
+    // the executor resuming the task, the default executor until it is spawned or awaited by another task.
+    coroutine_executor_ref ex_;
+    // the coroutine awaiting the task, resumed when it finishes.
+    std::coroutine_handle<> continuation_;
+    // whether the task has been spawned, and so destroys its coroutine frame when it finishes.
+    bool detached_;
+
+    struct final_awaiter
+    {
+      bool detached_;
+      bool await_ready() noexcept
+      {
+        return detached_;
+      }
+      template <typename Promise>
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) noexcept
+      {
+        std::coroutine_handle<> c = h.promise().continuation_;
+        return c ? c : std::noop_coroutine();
+      }
+      void await_resume() noexcept {}
+    };
+    task_promise_base() : detached_(false) {}
+
+    std::suspend_always initial_suspend() noexcept
+    {
+      return std::suspend_always();
+    }
+    final_awaiter final_suspend() noexcept
+    {
+      final_awaiter a = { detached_ };
+      return a;
+    }
+
+    /// the futures awaited by a task resume it on its executor.
+    template <typename F>
+    typename enable_if<is_awaited_future<typename decay<F>::type>,
+      future_awaiter<typename decay<F>::type> >::type
+    await_transform(F&& f)
+    {
+      static_assert(! is_lvalue_reference<F>::value || ! is_unique_awaited_future<typename decay<F>::type>::value,
+          "a future can only be awaited by rvalue: co_await boost::move(f)");
+      return future_awaiter<typename decay<F>::type>(typename decay<F>::type(std::forward<F>(f)), ex_);
+    }
+    template <typename A>
+    typename disable_if<is_awaited_future<typename decay<A>::type>, A&&>::type
+    await_transform(A&& a)
+    {
+      return std::forward<A>(a);
+    }
+  };
+
+  template <typename T>
+  class task_promise: public task_promise_base
+  {
+  protected:
+    promise<T> result_;
+  public:
+    task<T> get_return_object();
+    BOOST_THREAD_FUTURE<T> get_future()
+    {
+      return result_.get_future();
+    }
+    void unhandled_exception()
+    {
+      result_.set_exception(boost::current_exception());
+    }
+  };
+
+  template <typename T>
+  struct task_value_promise: task_promise<T>
+  {
+    template <typename U>
+    void return_value(U&& v)
+    {
+      this->result_.set_value(std::forward<U>(v));
+    }
+  };
+  template <>
+  struct task_value_promise<void>: task_promise<void>
+  {
+    void return_void()
+    {
+      this->result_.set_value();
+    }
+  };
+
+  /// the awaiter of a task, that starts it in the calling coroutine and is resumed when it finishes.
+  template <typename T>
+  class task_awaiter
+  {
+    typedef typename task<T>::promise_type promise_type;
+    std::coroutine_handle<promise_type> h_;
+    BOOST_THREAD_FUTURE<T> result_;
+  public:
+    explicit task_awaiter(std::coroutine_handle<promise_type> h) : h_(h), result_(h.promise().get_future()) {}
+
+    bool await_ready()
+    {
+      return false;
+    }
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> awaiting)
+    {
+      h_.promise().continuation_ = awaiting;
+      if constexpr (is_base_of<task_promise_base, Promise>::value)
+      {
+        // a task awaited by a task is resumed by the executor of the awaiting task.
+        h_.promise().ex_ = awaiting.promise().ex_;
+      }
+      return h_;
+    }
+    T await_resume()
+    {
+      return result_.get();
+    }
+  };
+}
+
+  /**
+   * A coroutine returning a \c T, that starts when it is awaited by another coroutine or when it is spawned on an
+   * executor. The futures it awaits resume it on the executor it runs on, so that the number of threads used stays
+   * bounded by the executor whatever the number of tasks waiting for a result.
+   */
+  template <typename T>
+  class task
+  {
+  public:
+    typedef detail::task_value_promise<T> promise_type;
+  private:
+    template <typename> friend class detail::task_promise;
+    template <typename Ex, typename U> friend BOOST_THREAD_FUTURE<U> spawn(Ex&, task<U>);
+
+    std::coroutine_handle<promise_type> h_;
+
+    explicit task(std::coroutine_handle<promise_type> h) : h_(h) {}
+
+    std::coroutine_handle<promise_type> release()
+    {
+      std::coroutine_handle<promise_type> h = h_;
+      h_ = std::coroutine_handle<promise_type>();
+      return h;
+    }
+  public:
+    task(task const&) = delete;
+    task& operator=(task const&) = delete;
+
+    task(task&& other) noexcept : h_(other.release()) {}
+    task& operator=(task&& other) noexcept
+    {
+      if (this != &other)
+      {
+        if (h_) h_.destroy();
+        h_ = other.release();
+      }
+      return *this;
+    }
+
+    /**
+     * \b Effects: Destroys the coroutine if it has not been spawned.
+     *
+     * \b Requires: The task is not being awaited.
+     */
+    ~task()
+    {
+      if (h_) h_.destroy();
+    }
+
+    /// \b Returns: whether the task still owns its coroutine.
+    bool valid() const noexcept
+    {
+      return bool(h_);
+    }
+
+    /**
+     * \b Effects: Starts the task in the awaiting coroutine, which is resumed with its result when it finishes.
+     *
+     * \b Requires: \c valid().
+     */
+    detail::task_awaiter<T> operator co_await() &&
+    {
+      return detail::task_awaiter<T>(h_);
+    }
+  };
+
+namespace detail
+{
+  template <typename T>
+  task<T> task_promise<T>::get_return_object()
+  {
+    return task<T>(std::coroutine_handle<typename task<T>::promise_type>::from_promise(
+        static_cast<typename task<T>::promise_type&>(*this)));
+  }
+}
+
+  /**
+   * \b Effects: Submits the start of the task \c t to \c ex, which then owns it.
+   *
+   * \b Returns: A future that becomes ready with the result of the task.
+   *
+   * \b Throws: Whatever \c ex.submit() throws, in which case the task is destroyed.
+   */
+  template <typename Ex, typename T>
+  BOOST_THREAD_FUTURE<T> spawn(Ex& ex, task<T> t)
+  {
+    BOOST_THREAD_ASSERT_PRECONDITION(t.valid(), future_uninitialized());
+    std::coroutine_handle<typename task<T>::promise_type> h = t.release();
+    h.promise().ex_ = detail::coroutine_executor_ref(ex);
+    h.promise().detached_ = true;
+    BOOST_THREAD_FUTURE<T> f = h.promise().get_future();
+    try
+    {
+      detail::coroutine_resumer r = { h };
+      ex.submit(r);
+    }
+    catch (...)
+    {
+      h.destroy();
+      throw;
+    }
+    return boost::move(f);
+  }
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif // BOOST_THREAD_PROVIDES_FUTURE_COROUTINES
+#endif
@@ -22,7 +22,8 @@ namespace boost
       broken_promise = 1,
       future_already_retrieved,
       promise_already_satisfied,
-      no_state
+      no_state,
+      operation_cancelled
   }
   BOOST_SCOPED_ENUM_DECLARE_END(future_errc)
 
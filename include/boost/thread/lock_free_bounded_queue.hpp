@@ -0,0 +1,479 @@
+#ifndef BOOST_THREAD_LOCK_FREE_BOUNDED_QUEUE_HPP
+#define BOOST_THREAD_LOCK_FREE_BOUNDED_QUEUE_HPP
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/thread for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread_only.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/sync_bounded_queue.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/atomic.hpp>
+#include <boost/assert.hpp>
+#include <cstddef>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+
+  /**
+   * A bounded multiple producer/multiple consumer queue.
+   *
+   * The push and pull operations don't lock any mutex: producers and consumers claim a cell of a power of two ring
+   * with a CAS on the back or front index and synchronize on a per-cell sequence number, following the bounded MPMC
+   * queue of D. Vyukov.
+   * The waiting operations poll the queue at most BOOST_THREAD_QUEUE_SPIN_COUNT times and then block on an internal
+   * condition variable until the queue is not full or not empty.
+   *
+   * Note that the value_type move assignment should not throw as a cell that has been claimed must be filled.
+   */
+  template <typename ValueType>
+  class lock_free_bounded_queue
+  {
+  public:
+    typedef ValueType value_type;
+    typedef std::size_t size_type;
+
+    // Constructors/Assignment/Destructors
+    BOOST_THREAD_NO_COPYABLE(lock_free_bounded_queue)
+    explicit lock_free_bounded_queue(size_type max_elems);
+    ~lock_free_bounded_queue();
+
+    // Observers
+    inline bool empty() const;
+    inline bool full() const;
+    inline size_type capacity() const;
+    inline size_type size() const;
+    inline bool closed() const;
+
+    // Modifiers
+    inline void close();
+
+    inline void push_back(const value_type& x);
+    inline void push_back(BOOST_THREAD_RV_REF(value_type) x);
+    inline queue_op_status try_push_back(const value_type& x);
+    inline queue_op_status try_push_back(BOOST_THREAD_RV_REF(value_type) x);
+    inline queue_op_status nonblocking_push_back(const value_type& x);
+    inline queue_op_status nonblocking_push_back(BOOST_THREAD_RV_REF(value_type) x);
+    inline queue_op_status wait_push_back(const value_type& x);
+    inline queue_op_status wait_push_back(BOOST_THREAD_RV_REF(value_type) x);
+
+    // Observers/Modifiers
+    inline void pull_front(value_type&);
+    // enable_if is_nothrow_copy_movable<value_type>
+    inline value_type pull_front();
+    inline queue_op_status try_pull_front(value_type&);
+    inline queue_op_status nonblocking_pull_front(value_type&);
+
+    inline queue_op_status wait_pull_front(ValueType& elem);
+
+  private:
+    struct cell
+    {
+      atomic<size_type> sequence_;
+      value_type data_;
+    };
+
+    char pad0_[64];
+    cell* const buffer_;
+    size_type const mask_;
+    char pad1_[64 - sizeof(cell*) - sizeof(size_type)];
+    /// the back index, whose highest bit is set once the queue is closed, so that a producer can't claim a cell
+    /// after the queue has been closed.
+    atomic<size_type> in_;
+    char pad2_[64 - sizeof(atomic<size_type>)];
+    atomic<size_type> out_;
+    char pad3_[64 - sizeof(atomic<size_type>)];
+    atomic<size_type> waiting_full_;
+    atomic<size_type> waiting_empty_;
+    mutex mtx_;
+    condition_variable not_empty_;
+    condition_variable not_full_;
+
+    /// the highest bit of in_, which leaves 2^63 pushes before the indexes wrap on 64-bit platforms.
+    BOOST_STATIC_CONSTANT(size_type, closed_bit = ~(~size_type(0) >> 1));
+
+    static size_type round_up_capacity(size_type max_elems) BOOST_NOEXCEPT
+    {
+      size_type res = 2;
+      while (res < max_elems) res <<= 1;
+      return res;
+    }
+
+    inline cell* claim_back(size_type& pos, bool& is_closed);
+    inline cell* claim_front(size_type& pos);
+    inline bool can_push() const;
+    inline bool can_pull() const;
+
+    inline queue_op_status try_push_back_from(value_type& x);
+    inline queue_op_status wait_push_back_from(value_type& x);
+
+    inline void wait_until_can_push();
+    inline void wait_until_can_pull();
+    inline void notify_not_empty_if_needed();
+    inline void notify_not_full_if_needed();
+  };
+
+  template <typename ValueType>
+  lock_free_bounded_queue<ValueType>::lock_free_bounded_queue(size_type max_elems) :
+    buffer_(new cell[round_up_capacity(max_elems)]), mask_(round_up_capacity(max_elems) - 1),
+        in_(0), out_(0), waiting_full_(0), waiting_empty_(0)
+  {
+    BOOST_ASSERT_MSG(max_elems >= 1, "number of elements must be > 1");
+    for (size_type i = 0; i <= mask_; ++i)
+    {
+      buffer_[i].sequence_.store(i, memory_order_relaxed);
+    }
+  }
+
+  template <typename ValueType>
+  lock_free_bounded_queue<ValueType>::~lock_free_bounded_queue()
+  {
+    delete[] buffer_;
+  }
+
+  template <typename ValueType>
+  bool lock_free_bounded_queue<ValueType>::empty() const
+  {
+    return size() == 0;
+  }
+
+  template <typename ValueType>
+  bool lock_free_bounded_queue<ValueType>::full() const
+  {
+    return size() == capacity();
+  }
+
+  template <typename ValueType>
+  typename lock_free_bounded_queue<ValueType>::size_type lock_free_bounded_queue<ValueType>::capacity() const
+  {
+    return mask_ + 1;
+  }
+
+  template <typename ValueType>
+  typename lock_free_bounded_queue<ValueType>::size_type lock_free_bounded_queue<ValueType>::size() const
+  {
+    size_type out = out_.load(memory_order_acquire);
+    size_type in = in_.load(memory_order_acquire) & ~closed_bit;
+    std::ptrdiff_t res = static_cast<std::ptrdiff_t>(in - out);
+    if (res < 0) return 0;
+    if (static_cast<size_type>(res) > capacity()) return capacity();
+    return static_cast<size_type>(res);
+  }
+
+  template <typename ValueType>
+  bool lock_free_bounded_queue<ValueType>::closed() const
+  {
+    return (in_.load(memory_order_acquire) & closed_bit) != 0;
+  }
+
+  template <typename ValueType>
+  void lock_free_bounded_queue<ValueType>::close()
+  {
+    in_.fetch_or(closed_bit, memory_order_seq_cst);
+    {
+      lock_guard<mutex> lk(mtx_);
+    }
+    not_empty_.notify_all();
+    not_full_.notify_all();
+  }
+
+  template <typename ValueType>
+  typename lock_free_bounded_queue<ValueType>::cell* lock_free_bounded_queue<ValueType>::claim_back(size_type& pos, bool& is_closed)
+  {
+    pos = in_.load(memory_order_relaxed);
+    for (;;)
+    {
+      // the CAS below fails once the closed bit is set, so no cell is claimed after the queue has been closed.
+      is_closed = (pos & closed_bit) != 0;
+      if (is_closed) return 0;
+      cell* c = &buffer_[pos & mask_];
+      size_type seq = c->sequence_.load(memory_order_acquire);
+      std::ptrdiff_t dif = static_cast<std::ptrdiff_t>(seq - pos);
+      if (dif == 0)
+      {
+        if (in_.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) return c;
+      }
+      else if (dif < 0)
+      {
+        // the cell has not been pulled yet since the last lap
+        return 0;
+      }
+      else
+      {
+        pos = in_.load(memory_order_relaxed);
+      }
+    }
+  }
+
+  template <typename ValueType>
+  typename lock_free_bounded_queue<ValueType>::cell* lock_free_bounded_queue<ValueType>::claim_front(size_type& pos)
+  {
+    pos = out_.load(memory_order_relaxed);
+    for (;;)
+    {
+      cell* c = &buffer_[pos & mask_];
+      size_type seq = c->sequence_.load(memory_order_acquire);
+      std::ptrdiff_t dif = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+      if (dif == 0)
+      {
+        if (out_.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) return c;
+      }
+      else if (dif < 0)
+      {
+        // the cell has not been pushed yet
+        return 0;
+      }
+      else
+      {
+        pos = out_.load(memory_order_relaxed);
+      }
+    }
+  }
+
+  template <typename ValueType>
+  bool lock_free_bounded_queue<ValueType>::can_push() const
+  {
+    size_type pos = in_.load(memory_order_relaxed) & ~closed_bit;
+    return buffer_[pos & mask_].sequence_.load(memory_order_acquire) == pos;
+  }
+
+  template <typename ValueType>
+  bool lock_free_bounded_queue<ValueType>::can_pull() const
+  {
+    size_type pos = out_.load(memory_order_relaxed);
+    return buffer_[pos & mask_].sequence_.load(memory_order_acquire) == pos + 1;
+  }
+
+  template <typename ValueType>
+  void lock_free_bounded_queue<ValueType>::notify_not_empty_if_needed()
+  {
+    // pairs with the fence in wait_until_can_pull: either the waiter sees the new element or we see the waiter.
+    atomic_thread_fence(memory_order_seq_cst);
+    if (waiting_empty_.load(memory_order_relaxed) > 0)
+    {
+      lock_guard<mutex> lk(mtx_);
+      not_empty_.notify_one();
+    }
+  }
+
+  template <typename ValueType>
+  void lock_free_bounded_queue<ValueType>::notify_not_full_if_needed()
+  {
+    atomic_thread_fence(memory_order_seq_cst);
+    if (waiting_full_.load(memory_order_relaxed) > 0)
+    {
+      lock_guard<mutex> lk(mtx_);
+      not_full_.notify_one();
+    }
+  }
+
+  template <typename ValueType>
+  void lock_free_bounded_queue<ValueType>::wait_until_can_pull()
+  {
+    for (unsigned i = 0; i < BOOST_THREAD_QUEUE_SPIN_COUNT; ++i)
+    {
+      if (can_pull() || closed()) return;
+      this_thread::yield();
+    }
+    unique_lock<mutex> lk(mtx_);
+    waiting_empty_.fetch_add(1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    while (! can_pull() && ! closed())
+    {
+      not_empty_.wait(lk);
+    }
+    waiting_empty_.fetch_sub(1, memory_order_relaxed);
+  }
+
+  template <typename ValueType>
+  void lock_free_bounded_queue<ValueType>::wait_until_can_push()
+  {
+    for (unsigned i = 0; i < BOOST_THREAD_QUEUE_SPIN_COUNT; ++i)
+    {
+      if (can_push() || closed()) return;
+      this_thread::yield();
+    }
+    unique_lock<mutex> lk(mtx_);
+    waiting_full_.fetch_add(1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    while (! can_push() && ! closed())
+    {
+      not_full_.wait(lk);
+    }
+    waiting_full_.fetch_sub(1, memory_order_relaxed);
+  }
+
+  template <typename ValueType>
+  queue_op_status lock_free_bounded_queue<ValueType>::try_pull_front(ValueType& elem)
+  {
+    size_type pos;
+    cell* c = claim_front(pos);
+    if (c == 0)
+    {
+      // an element claimed by a producer before the queue was closed could still be on its way
+      size_type in = in_.load(memory_order_acquire);
+      if ((in & closed_bit) != 0 && (in & ~closed_bit) == out_.load(memory_order_relaxed))
+      {
+        return queue_op_status::closed;
+      }
+      return queue_op_status::empty;
+    }
+    elem = boost::move(c->data_);
+    c->sequence_.store(pos + mask_ + 1, memory_order_release);
+    notify_not_full_if_needed();
+    return queue_op_status::success;
+  }
+
+  template <typename ValueType>
+  queue_op_status lock_free_bounded_queue<ValueType>::nonblocking_pull_front(ValueType& elem)
+  {
+    return try_pull_front(elem);
+  }
+
+  template <typename ValueType>
+  queue_op_status lock_free_bounded_queue<ValueType>::wait_pull_front(ValueType& elem)
+  {
+    for (;;)
+    {
+      queue_op_status st = try_pull_front(elem);
+      if (st != queue_op_status::empty) return st;
+      wait_until_can_pull();
+    }
+  }
+
+  template <typename ValueType>
+  void lock_free_bounded_queue<ValueType>::pull_front(ValueType& elem)
+  {
+    if (wait_pull_front(elem) == queue_op_status::closed)
+    {
+      BOOST_THROW_EXCEPTION( sync_queue_is_closed() );
+    }
+  }
+
+  template <typename ValueType>
+  ValueType lock_free_bounded_queue<ValueType>::pull_front()
+  {
+    value_type elem;
+    pull_front(elem);
+    return boost::move(elem);
+  }
+
+  template <typename ValueType>
+  queue_op_status lock_free_bounded_queue<ValueType>::try_push_back_from(ValueType& elem)
+  {
+    size_type pos;
+    bool is_closed;
+    cell* c = claim_back(pos, is_closed);
+    if (c == 0) return is_closed ? queue_op_status::closed : queue_op_status::full;
+    c->data_ = boost::move(elem);
+    c->sequence_.store(pos + 1, memory_order_release);
+    notify_not_empty_if_needed();
+    return queue_op_status::success;
+  }
+
+  template <typename ValueType>
+  queue_op_status lock_free_bounded_queue<ValueType>::wait_push_back_from(ValueType& elem)
+  {
+    for (;;)
+    {
+      queue_op_status st = try_push_back_from(elem);
+      if (st != queue_op_status::full) return st;
+      wait_until_can_push();
+    }
+  }
+
+  template <typename ValueType>
+  queue_op_status lock_free_bounded_queue<ValueType>::try_push_back(const ValueType& elem)
+  {
+    // copy before claiming a cell so that a throwing copy leaves the queue unmodified
+    value_type tmp(elem);
+    return try_push_back_from(tmp);
+  }
+
+  template <typename ValueType>
+  queue_op_status lock_free_bounded_queue<ValueType>::try_push_back(BOOST_THREAD_RV_REF(ValueType) elem)
+  {
+    return try_push_back_from(BOOST_THREAD_RV(elem));
+  }
+
+  template <typename ValueType>
+  queue_op_status lock_free_bounded_queue<ValueType>::nonblocking_push_back(const ValueType& elem)
+  {
+    return try_push_back(elem);
+  }
+
+  template <typename ValueType>
+  queue_op_status lock_free_bounded_queue<ValueType>::nonblocking_push_back(BOOST_THREAD_RV_REF(ValueType) elem)
+  {
+    return try_push_back_from(BOOST_THREAD_RV(elem));
+  }
+
+  template <typename ValueType>
+  queue_op_status lock_free_bounded_queue<ValueType>::wait_push_back(const ValueType& elem)
+  {
+    value_type tmp(elem);
+    return wait_push_back_from(tmp);
+  }
+
+  template <typename ValueType>
+  queue_op_status lock_free_bounded_queue<ValueType>::wait_push_back(BOOST_THREAD_RV_REF(ValueType) elem)
+  {
+    return wait_push_back_from(BOOST_THREAD_RV(elem));
+  }
+
+  template <typename ValueType>
+  void lock_free_bounded_queue<ValueType>::push_back(const ValueType& elem)
+  {
+    if (wait_push_back(elem) == queue_op_status::closed)
+    {
+      BOOST_THROW_EXCEPTION( sync_queue_is_closed() );
+    }
+  }
+
+  template <typename ValueType>
+  void lock_free_bounded_queue<ValueType>::push_back(BOOST_THREAD_RV_REF(ValueType) elem)
+  {
+    if (wait_push_back_from(BOOST_THREAD_RV(elem)) == queue_op_status::closed)
+    {
+      BOOST_THROW_EXCEPTION( sync_queue_is_closed() );
+    }
+  }
+
+  template <typename ValueType>
+  lock_free_bounded_queue<ValueType>& operator<<(lock_free_bounded_queue<ValueType>& sbq, BOOST_THREAD_RV_REF(ValueType) elem)
+  {
+    sbq.push_back(boost::move(elem));
+    return sbq;
+  }
+
+  template <typename ValueType>
+  lock_free_bounded_queue<ValueType>& operator<<(lock_free_bounded_queue<ValueType>& sbq, ValueType const&elem)
+  {
+    sbq.push_back(elem);
+    return sbq;
+  }
+
+  template <typename ValueType>
+  lock_free_bounded_queue<ValueType>& operator>>(lock_free_bounded_queue<ValueType>& sbq, ValueType &elem)
+  {
+    sbq.pull_front(elem);
+    return sbq;
+  }
+
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
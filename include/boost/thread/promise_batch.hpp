@@ -0,0 +1,343 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_PROMISE_BATCH_HPP
+#define BOOST_THREAD_PROMISE_BATCH_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <utility>
+#include <vector>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+namespace detail
+{
+  /// launches each continuation with the mutex of its parent locked, as the parent would have done.
+  inline void launch_continuations(shared_state_base::continuations_type& continuations)
+  {
+    for (shared_state_base::continuations_type::iterator it = continuations.begin(); it != continuations.end(); ++it)
+    {
+      boost::unique_lock<boost::mutex> lk(it->first->mutex);
+      it->second->launch_continuation(lk);
+    }
+    continuations.clear();
+  }
+
+  /// the closure launching the continuations of a committed batch on an executor, cheap to copy.
+  struct batch_continuations_task
+  {
+    shared_ptr<shared_state_base::continuations_type> continuations_;
+
+    explicit batch_continuations_task(shared_ptr<shared_state_base::continuations_type> const& c) : continuations_(c) {}
+    void operator()()
+    {
+      launch_continuations(*continuations_);
+    }
+  };
+
+  /// the part of a promise_batch that doesn't depend on how the values are stored.
+  template <typename R>
+  class promise_batch_base
+  {
+  protected:
+    struct entry
+    {
+      shared_ptr<shared_state<R> > state;
+      exception_ptr exception;
+      entry(shared_ptr<shared_state<R> > const& st, exception_ptr const& e) : state(st), exception(e) {}
+    };
+    std::vector<entry> entries_;
+    shared_state_base::continuations_type continuations_;
+
+    /**
+     * \b Returns: the shared state of \c p, throwing as \c p.set_value() would if it can't be satisfied. The state
+     * is marked as constructed, as with set_value_at_thread_exit, so that \c p can be destroyed before the commit
+     * without breaking its promise.
+     */
+    static shared_ptr<shared_state<R> > const& state_of(promise<R>& p)
+    {
+      p.lazy_init();
+      if (p.future_.get() == 0)
+      {
+        boost::throw_exception(promise_moved());
+      }
+      boost::lock_guard<boost::mutex> lk(p.future_->mutex);
+      if (p.future_->done)
+      {
+        boost::throw_exception(promise_already_satisfied());
+      }
+      p.future_->is_constructed = true;
+      return p.future_;
+    }
+
+    /**
+     * Makes ready the states of the batch, each one with a single lock of its mutex, and collects their
+     * continuations. \c Store is called to store the value of the i-th entry holding a value.
+     * Returns whether all the states were still waiting.
+     */
+    template <typename Store>
+    bool make_ready(Store& store)
+    {
+      bool all_waiting = true;
+      std::size_t value = 0;
+      // the closure submitted by the previous commit took the storage of the continuations
+      continuations_.reserve(entries_.size());
+      for (typename std::vector<entry>::iterator it = entries_.begin(); it != entries_.end(); ++it)
+      {
+        shared_state<R>& st = *it->state;
+        boost::unique_lock<boost::mutex> lk(st.mutex);
+        if (st.done)
+        {
+          // satisfied since it was added
+          all_waiting = false;
+          if (! it->exception) ++value;
+          continue;
+        }
+        if (it->exception)
+        {
+          st.exception = it->exception;
+        }
+        else
+        {
+          store(st, value++);
+        }
+        st.mark_finished_collecting_continuations(lk, continuations_);
+      }
+      entries_.clear();
+      return all_waiting;
+    }
+
+    void launch(bool all_waiting)
+    {
+      launch_continuations(continuations_);
+      if (! all_waiting)
+      {
+        boost::throw_exception(promise_already_satisfied());
+      }
+    }
+
+    template <typename Ex>
+    void launch(Ex& ex, bool all_waiting)
+    {
+      if (! continuations_.empty())
+      {
+        batch_continuations_task task(boost::make_shared<shared_state_base::continuations_type>());
+        task.continuations_->swap(continuations_);
+        try
+        {
+          ex.submit(task);
+        }
+        catch (...)
+        {
+          // the executor is closed, so they are launched here rather than lost
+          task();
+        }
+      }
+      if (! all_waiting)
+      {
+        boost::throw_exception(promise_already_satisfied());
+      }
+    }
+
+  public:
+    promise_batch_base() {}
+
+    /// \b Effects: Breaks the promises added since the last commit, as their promise would if destroyed.
+    ~promise_batch_base()
+    {
+      for (typename std::vector<entry>::iterator it = entries_.begin(); it != entries_.end(); ++it)
+      {
+        boost::unique_lock<boost::mutex> lk(it->state->mutex);
+        if (! it->state->done)
+        {
+          it->state->mark_exceptional_finish_internal(boost::copy_exception(broken_promise()), lk);
+        }
+      }
+    }
+
+    /// \b Returns: the number of promises to fulfil on the next commit.
+    std::size_t size() const
+    {
+      return entries_.size();
+    }
+    /// \b Returns: whether there is nothing to commit.
+    bool empty() const
+    {
+      return entries_.empty();
+    }
+    /// \b Effects: Reserves room for \c n promises, so that filling the batch again doesn't allocate.
+    void reserve(std::size_t n)
+    {
+      entries_.reserve(n);
+    }
+
+    /**
+     * \b Effects: Adds the fulfilment of \c p with the exception \c e to the batch. The future of \c p stays not
+     * ready until the batch is committed.
+     *
+     * \b Throws: \c promise_moved if \c p has no shared state, \c promise_already_satisfied if it is already satisfied.
+     */
+    void set_exception(promise<R>& p, exception_ptr e)
+    {
+      entries_.push_back(entry(state_of(p), e));
+    }
+    template <typename E>
+    void set_exception(promise<R>& p, E ex)
+    {
+      set_exception(p, copy_exception(ex));
+    }
+  };
+}
+
+  /**
+   * Collects the values and exceptions of many promises and makes all their futures ready in a single pass when
+   * committed: the mutex of each shared state is locked once and its waiters are notified at once, while its
+   * continuations are collected and launched once the whole batch is ready, either by the committing thread or
+   * by a single closure submitted to an executor.
+   *
+   * A batch is not thread safe. It is empty again once committed, and keeps the capacity of its entries so that a
+   * batch can be reused for each incoming bunch of results.
+   */
+  template <typename R>
+  class promise_batch: public detail::promise_batch_base<R>
+  {
+    typedef detail::promise_batch_base<R> base_type;
+    std::vector<R> values_;
+
+    struct store_value
+    {
+      std::vector<R>& values_;
+      explicit store_value(std::vector<R>& values) : values_(values) {}
+      void operator()(detail::shared_state<R>& st, std::size_t i)
+      {
+        detail::future_traits<R>::init(st.result, boost::move(values_[i]));
+      }
+    };
+  public:
+    /**
+     * \b Effects: Adds the fulfilment of \c p with the value \c v to the batch. The future of \c p stays not ready
+     * until the batch is committed.
+     *
+     * \b Throws: \c promise_moved if \c p has no shared state, \c promise_already_satisfied if it is already satisfied.
+     */
+    void set_value(promise<R>& p, R const& v)
+    {
+      this->entries_.push_back(typename base_type::entry(this->state_of(p), exception_ptr()));
+      try
+      {
+        values_.push_back(v);
+      }
+      catch (...)
+      {
+        this->entries_.pop_back();
+        throw;
+      }
+    }
+#if ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+    void set_value(promise<R>& p, R&& v)
+    {
+      this->entries_.push_back(typename base_type::entry(this->state_of(p), exception_ptr()));
+      try
+      {
+        values_.push_back(boost::move(v));
+      }
+      catch (...)
+      {
+        this->entries_.pop_back();
+        throw;
+      }
+    }
+#endif
+
+    void reserve(std::size_t n)
+    {
+      base_type::reserve(n);
+      values_.reserve(n);
+    }
+
+    /**
+     * \b Effects: Makes the futures of the batch ready, and then launches their continuations in the calling thread.
+     *
+     * \b Throws: \c promise_already_satisfied if a promise has been satisfied since it was added, once the other
+     * futures are ready and their continuations launched.
+     */
+    void commit()
+    {
+      store_value store(values_);
+      bool all_waiting = this->make_ready(store);
+      values_.clear();
+      this->launch(all_waiting);
+    }
+
+    /**
+     * \b Effects: Makes the futures of the batch ready, and then submits to \c ex a single closure launching all
+     * their continuations. If \c ex refuses it, the continuations are launched in the calling thread.
+     *
+     * \b Throws: \c promise_already_satisfied if a promise has been satisfied since it was added, once the other
+     * futures are ready and their continuations launched.
+     */
+    template <typename Ex>
+    void commit(Ex& ex)
+    {
+      store_value store(values_);
+      bool all_waiting = this->make_ready(store);
+      values_.clear();
+      this->launch(ex, all_waiting);
+    }
+  };
+
+  template <>
+  class promise_batch<void>: public detail::promise_batch_base<void>
+  {
+    typedef detail::promise_batch_base<void> base_type;
+
+    struct store_value
+    {
+      void operator()(detail::shared_state<void>&, std::size_t)
+      {
+      }
+    };
+  public:
+    /**
+     * \b Effects: Adds the fulfilment of \c p to the batch. The future of \c p stays not ready until the batch is
+     * committed.
+     *
+     * \b Throws: \c promise_moved if \c p has no shared state, \c promise_already_satisfied if it is already satisfied.
+     */
+    void set_value(promise<void>& p)
+    {
+      this->entries_.push_back(base_type::entry(state_of(p), exception_ptr()));
+    }
+
+    /// \b Effects: As \c promise_batch<R>::commit().
+    void commit()
+    {
+      store_value store;
+      bool all_waiting = this->make_ready(store);
+      this->launch(all_waiting);
+    }
+
+    /// \b Effects: As \c promise_batch<R>::commit(ex).
+    template <typename Ex>
+    void commit(Ex& ex)
+    {
+      store_value store;
+      bool all_waiting = this->make_ready(store);
+      this->launch(ex, all_waiting);
+    }
+  };
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -63,6 +63,33 @@ namespace boost
             BOOST_VERIFY(!res && "pthread_attr_getstacksize failed");
             return size;
         }
+
+        // affinity
+        // restricts the thread to the given cpus, or to any cpu if empty.
+        // Returns false if the platform doesn't support affinity or a cpu is out of range.
+        bool set_affinity(std::vector<unsigned> const& cpus) BOOST_NOEXCEPT {
+#if defined __GLIBC__ && defined _GNU_SOURCE && defined CPU_SETSIZE
+          cpu_set_t set;
+          CPU_ZERO(&set);
+          if (cpus.empty()) {
+            for (unsigned cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+              CPU_SET(cpu, &set);
+            }
+            return pthread_attr_setaffinity_np(&val_, sizeof(set), &set) == 0;
+          }
+          for (std::size_t i = 0; i < cpus.size(); ++i) {
+            if (cpus[i] >= CPU_SETSIZE) return false;
+            CPU_SET(cpus[i], &set);
+          }
+          return pthread_attr_setaffinity_np(&val_, sizeof(set), &set) == 0;
+#else
+          return cpus.empty();
+#endif
+        }
+        // restricts the thread to the cpus of the NUMA node.
+        // Returns false if the platform doesn't support affinity or \c node has no cpu.
+        bool BOOST_THREAD_DECL set_numa_node(unsigned node);
+
 #define BOOST_THREAD_DEFINES_THREAD_ATTRIBUTES_NATIVE_HANDLE
 
         typedef pthread_attr_t native_handle_type;
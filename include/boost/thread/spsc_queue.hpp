@@ -0,0 +1,541 @@
+#ifndef BOOST_THREAD_SPSC_QUEUE_HPP
+#define BOOST_THREAD_SPSC_QUEUE_HPP
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright agent 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/thread for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread_only.hpp>
+#include <boost/thread/detail/move.hpp>
+#include <boost/thread/sync_bounded_queue.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/atomic.hpp>
+#include <boost/assert.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+
+  /**
+   * A bounded single producer/single consumer queue.
+   *
+   * Only one thread can push elements and only one thread can pull them at a given time. The push and pull
+   * operations don't lock any mutex: each side owns its index and keeps a cached copy of the other side index,
+   * so that the shared cache lines are only read when the queue seems full or empty.
+   * The range push and pull operations publish all their elements at once.
+   * The closed flag is the high bit of the producer index, so that an element is either published before the
+   * queue is closed, and then it must be pulled, or the push reports closed.
+   *
+   * The waiting operations poll the queue at most BOOST_THREAD_QUEUE_SPIN_COUNT times and then block on an internal
+   * condition variable until the queue is not full or not empty.
+   */
+  template <typename ValueType>
+  class spsc_queue
+  {
+  public:
+    typedef ValueType value_type;
+    typedef std::size_t size_type;
+
+    // Constructors/Assignment/Destructors
+    BOOST_THREAD_NO_COPYABLE(spsc_queue)
+    explicit spsc_queue(size_type max_elems);
+    ~spsc_queue();
+
+    // Observers
+    inline bool empty() const;
+    inline bool full() const;
+    inline size_type capacity() const;
+    inline size_type size() const;
+    inline bool closed() const;
+
+    // Modifiers
+    inline void close();
+
+    inline void push_back(const value_type& x);
+    inline void push_back(BOOST_THREAD_RV_REF(value_type) x);
+    inline queue_op_status try_push_back(const value_type& x);
+    inline queue_op_status try_push_back(BOOST_THREAD_RV_REF(value_type) x);
+    inline queue_op_status nonblocking_push_back(const value_type& x);
+    inline queue_op_status nonblocking_push_back(BOOST_THREAD_RV_REF(value_type) x);
+    inline queue_op_status wait_push_back(const value_type& x);
+    inline queue_op_status wait_push_back(BOOST_THREAD_RV_REF(value_type) x);
+
+    template <typename InputIterator>
+    inline void push_back(InputIterator first, InputIterator last);
+    template <typename InputIterator>
+    inline queue_op_status try_push_back(InputIterator& first, InputIterator last);
+
+    // Observers/Modifiers
+    inline void pull_front(value_type&);
+    // enable_if is_nothrow_copy_movable<value_type>
+    inline value_type pull_front();
+    inline queue_op_status try_pull_front(value_type&);
+    inline queue_op_status nonblocking_pull_front(value_type&);
+    inline queue_op_status wait_pull_front(ValueType& elem);
+
+    template <typename OutputIterator>
+    inline size_type pull_front(OutputIterator out, size_type max_n);
+    template <typename OutputIterator>
+    inline queue_op_status try_pull_front_n(OutputIterator out, size_type max_n, size_type& n);
+    template <typename OutputIterator>
+    inline queue_op_status wait_pull_front_n(OutputIterator out, size_type max_n, size_type& n);
+
+  private:
+    char pad0_[64];
+    // consumer side
+    atomic<size_type> out_;
+    size_type cached_in_;
+    char pad1_[64 - sizeof(atomic<size_type>) - sizeof(size_type)];
+    // producer side
+    atomic<size_type> in_;
+    size_type cached_out_;
+    char pad2_[64 - sizeof(atomic<size_type>) - sizeof(size_type)];
+    value_type* const data_;
+    size_type const mask_;
+    atomic<size_type> waiting_full_;
+    atomic<size_type> waiting_empty_;
+    mutex mtx_;
+    condition_variable not_empty_;
+    condition_variable not_full_;
+
+    BOOST_STATIC_CONSTANT(size_type, closed_bit = ~(~size_type(0) >> 1));
+
+    static size_type round_up_capacity(size_type max_elems) BOOST_NOEXCEPT
+    {
+      size_type res = 1;
+      while (res < max_elems) res <<= 1;
+      return res;
+    }
+
+    /// the number of free slots seen by the producer, refreshing the cached consumer index only when needed
+    inline size_type free_slots(size_type in)
+    {
+      size_type res = capacity() - (in - cached_out_);
+      if (res == 0)
+      {
+        cached_out_ = out_.load(memory_order_acquire);
+        res = capacity() - (in - cached_out_);
+      }
+      return res;
+    }
+    /// the number of available elements seen by the consumer, refreshing the cached producer index only when needed
+    inline size_type available(size_type out)
+    {
+      size_type res = cached_in_ - out;
+      if (res == 0)
+      {
+        cached_in_ = in_.load(memory_order_acquire) & ~closed_bit;
+        res = cached_in_ - out;
+      }
+      return res;
+    }
+    inline queue_op_status closed_or_empty(size_type out);
+    /// publishes the elements written in [in, in_end) unless the queue has been closed meanwhile
+    inline bool publish(size_type in, size_type in_end)
+    {
+      return in_.compare_exchange_strong(in, in_end, memory_order_release, memory_order_relaxed);
+    }
+
+    inline queue_op_status wait_push_back_from(value_type& x);
+
+    inline void wait_until_can_push();
+    inline void wait_until_can_pull();
+    inline void notify_not_empty_if_needed();
+    inline void notify_not_full_if_needed();
+  };
+
+  template <typename ValueType>
+  spsc_queue<ValueType>::spsc_queue(size_type max_elems) :
+    out_(0), cached_in_(0), in_(0), cached_out_(0),
+        data_(new value_type[round_up_capacity(max_elems)]), mask_(round_up_capacity(max_elems) - 1),
+        waiting_full_(0), waiting_empty_(0)
+  {
+    BOOST_ASSERT_MSG(max_elems >= 1, "number of elements must be > 1");
+  }
+
+  template <typename ValueType>
+  spsc_queue<ValueType>::~spsc_queue()
+  {
+    delete[] data_;
+  }
+
+  template <typename ValueType>
+  bool spsc_queue<ValueType>::empty() const
+  {
+    return size() == 0;
+  }
+
+  template <typename ValueType>
+  bool spsc_queue<ValueType>::full() const
+  {
+    return size() == capacity();
+  }
+
+  template <typename ValueType>
+  typename spsc_queue<ValueType>::size_type spsc_queue<ValueType>::capacity() const
+  {
+    return mask_ + 1;
+  }
+
+  template <typename ValueType>
+  typename spsc_queue<ValueType>::size_type spsc_queue<ValueType>::size() const
+  {
+    size_type out = out_.load(memory_order_acquire);
+    size_type in = in_.load(memory_order_acquire) & ~closed_bit;
+    return in - out;
+  }
+
+  template <typename ValueType>
+  bool spsc_queue<ValueType>::closed() const
+  {
+    return (in_.load(memory_order_acquire) & closed_bit) != 0;
+  }
+
+  template <typename ValueType>
+  void spsc_queue<ValueType>::close()
+  {
+    in_.fetch_or(closed_bit, memory_order_seq_cst);
+    {
+      lock_guard<mutex> lk(mtx_);
+    }
+    not_empty_.notify_all();
+    not_full_.notify_all();
+  }
+
+  template <typename ValueType>
+  void spsc_queue<ValueType>::notify_not_empty_if_needed()
+  {
+    // pairs with the fence in wait_until_can_pull: either the waiter sees the new elements or we see the waiter.
+    atomic_thread_fence(memory_order_seq_cst);
+    if (waiting_empty_.load(memory_order_relaxed) > 0)
+    {
+      lock_guard<mutex> lk(mtx_);
+      not_empty_.notify_one();
+    }
+  }
+
+  template <typename ValueType>
+  void spsc_queue<ValueType>::notify_not_full_if_needed()
+  {
+    atomic_thread_fence(memory_order_seq_cst);
+    if (waiting_full_.load(memory_order_relaxed) > 0)
+    {
+      lock_guard<mutex> lk(mtx_);
+      not_full_.notify_one();
+    }
+  }
+
+  template <typename ValueType>
+  void spsc_queue<ValueType>::wait_until_can_pull()
+  {
+    size_type out = out_.load(memory_order_relaxed);
+    for (unsigned i = 0; i < BOOST_THREAD_QUEUE_SPIN_COUNT; ++i)
+    {
+      if (in_.load(memory_order_acquire) != out) return;
+      this_thread::yield();
+    }
+    unique_lock<mutex> lk(mtx_);
+    waiting_empty_.fetch_add(1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    // the closed bit makes the producer index differ from out
+    while (in_.load(memory_order_acquire) == out)
+    {
+      not_empty_.wait(lk);
+    }
+    waiting_empty_.fetch_sub(1, memory_order_relaxed);
+  }
+
+  template <typename ValueType>
+  void spsc_queue<ValueType>::wait_until_can_push()
+  {
+    size_type in = in_.load(memory_order_relaxed) & ~closed_bit;
+    for (unsigned i = 0; i < BOOST_THREAD_QUEUE_SPIN_COUNT; ++i)
+    {
+      if (in - out_.load(memory_order_acquire) != capacity() || closed()) return;
+      this_thread::yield();
+    }
+    unique_lock<mutex> lk(mtx_);
+    waiting_full_.fetch_add(1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    while (in - out_.load(memory_order_acquire) == capacity() && ! closed())
+    {
+      not_full_.wait(lk);
+    }
+    waiting_full_.fetch_sub(1, memory_order_relaxed);
+  }
+
+  template <typename ValueType>
+  queue_op_status spsc_queue<ValueType>::closed_or_empty(size_type out)
+  {
+    size_type in = in_.load(memory_order_acquire);
+    if (in & closed_bit)
+    {
+      // the elements pushed before the queue was closed must be pulled
+      cached_in_ = in & ~closed_bit;
+      if (cached_in_ == out) return queue_op_status::closed;
+      return queue_op_status::success;
+    }
+    return queue_op_status::empty;
+  }
+
+  template <typename ValueType>
+  queue_op_status spsc_queue<ValueType>::try_pull_front(ValueType& elem)
+  {
+    size_type out = out_.load(memory_order_relaxed);
+    if (available(out) == 0)
+    {
+      queue_op_status st = closed_or_empty(out);
+      if (st != queue_op_status::success) return st;
+    }
+    elem = boost::move(data_[out & mask_]);
+    out_.store(out + 1, memory_order_release);
+    notify_not_full_if_needed();
+    return queue_op_status::success;
+  }
+
+  template <typename ValueType>
+  queue_op_status spsc_queue<ValueType>::nonblocking_pull_front(ValueType& elem)
+  {
+    return try_pull_front(elem);
+  }
+
+  template <typename ValueType>
+  queue_op_status spsc_queue<ValueType>::wait_pull_front(ValueType& elem)
+  {
+    for (;;)
+    {
+      queue_op_status st = try_pull_front(elem);
+      if (st != queue_op_status::empty) return st;
+      wait_until_can_pull();
+    }
+  }
+
+  template <typename ValueType>
+  void spsc_queue<ValueType>::pull_front(ValueType& elem)
+  {
+    if (wait_pull_front(elem) == queue_op_status::closed)
+    {
+      BOOST_THROW_EXCEPTION( sync_queue_is_closed() );
+    }
+  }
+
+  template <typename ValueType>
+  ValueType spsc_queue<ValueType>::pull_front()
+  {
+    value_type elem;
+    pull_front(elem);
+    return boost::move(elem);
+  }
+
+  template <typename ValueType>
+  template <typename OutputIterator>
+  queue_op_status spsc_queue<ValueType>::try_pull_front_n(OutputIterator out, size_type max_n, size_type& n)
+  {
+    n = 0;
+    size_type o = out_.load(memory_order_relaxed);
+    // a batch pull reads the producer index once to get as many elements as possible
+    cached_in_ = in_.load(memory_order_acquire) & ~closed_bit;
+    size_type avail = cached_in_ - o;
+    if (avail == 0)
+    {
+      queue_op_status st = closed_or_empty(o);
+      if (st != queue_op_status::success) return st;
+      avail = cached_in_ - o;
+    }
+    if (avail > max_n) avail = max_n;
+    for (; n < avail; ++n, ++out)
+    {
+      *out = boost::move(data_[(o + n) & mask_]);
+    }
+    out_.store(o + n, memory_order_release);
+    notify_not_full_if_needed();
+    return queue_op_status::success;
+  }
+
+  template <typename ValueType>
+  template <typename OutputIterator>
+  queue_op_status spsc_queue<ValueType>::wait_pull_front_n(OutputIterator out, size_type max_n, size_type& n)
+  {
+    for (;;)
+    {
+      queue_op_status st = try_pull_front_n(out, max_n, n);
+      if (st != queue_op_status::empty) return st;
+      wait_until_can_pull();
+    }
+  }
+
+  template <typename ValueType>
+  template <typename OutputIterator>
+  typename spsc_queue<ValueType>::size_type spsc_queue<ValueType>::pull_front(OutputIterator out, size_type max_n)
+  {
+    size_type n;
+    if (wait_pull_front_n(out, max_n, n) == queue_op_status::closed)
+    {
+      BOOST_THROW_EXCEPTION( sync_queue_is_closed() );
+    }
+    return n;
+  }
+
+  template <typename ValueType>
+  queue_op_status spsc_queue<ValueType>::try_push_back(const ValueType& elem)
+  {
+    size_type in = in_.load(memory_order_relaxed);
+    if (in & closed_bit) return queue_op_status::closed;
+    if (free_slots(in) == 0) return queue_op_status::full;
+    // the element is only published once copied, so a throwing copy leaves the queue unmodified
+    data_[in & mask_] = elem;
+    if (! publish(in, in + 1)) return queue_op_status::closed;
+    notify_not_empty_if_needed();
+    return queue_op_status::success;
+  }
+
+  template <typename ValueType>
+  queue_op_status spsc_queue<ValueType>::try_push_back(BOOST_THREAD_RV_REF(ValueType) elem)
+  {
+    size_type in = in_.load(memory_order_relaxed);
+    if (in & closed_bit) return queue_op_status::closed;
+    if (free_slots(in) == 0) return queue_op_status::full;
+    data_[in & mask_] = boost::move(elem);
+    if (! publish(in, in + 1))
+    {
+      // closed before the element was published: give it back to the caller
+      static_cast<ValueType&>(elem) = boost::move(data_[in & mask_]);
+      return queue_op_status::closed;
+    }
+    notify_not_empty_if_needed();
+    return queue_op_status::success;
+  }
+
+  template <typename ValueType>
+  template <typename InputIterator>
+  queue_op_status spsc_queue<ValueType>::try_push_back(InputIterator& first, InputIterator last)
+  {
+    size_type in = in_.load(memory_order_relaxed);
+    if (in & closed_bit) return queue_op_status::closed;
+    if (first == last) return queue_op_status::success;
+    cached_out_ = out_.load(memory_order_acquire);
+    size_type free = capacity() - (in - cached_out_);
+    if (free == 0) return queue_op_status::full;
+    size_type n = 0;
+    InputIterator it = first;
+    for (; n < free && it != last; ++n, ++it)
+    {
+      data_[(in + n) & mask_] = *it;
+    }
+    // first is left unchanged if the queue was closed before the elements were published
+    if (! publish(in, in + n)) return queue_op_status::closed;
+    first = it;
+    notify_not_empty_if_needed();
+    return (first == last) ? queue_op_status::success : queue_op_status::full;
+  }
+
+  template <typename ValueType>
+  template <typename InputIterator>
+  void spsc_queue<ValueType>::push_back(InputIterator first, InputIterator last)
+  {
+    for (;;)
+    {
+      queue_op_status st = try_push_back(first, last);
+      if (st == queue_op_status::success) return;
+      if (st == queue_op_status::closed)
+      {
+        BOOST_THROW_EXCEPTION( sync_queue_is_closed() );
+      }
+      wait_until_can_push();
+    }
+  }
+
+  template <typename ValueType>
+  queue_op_status spsc_queue<ValueType>::nonblocking_push_back(const ValueType& elem)
+  {
+    return try_push_back(elem);
+  }
+
+  template <typename ValueType>
+  queue_op_status spsc_queue<ValueType>::nonblocking_push_back(BOOST_THREAD_RV_REF(ValueType) elem)
+  {
+    return try_push_back(boost::move(elem));
+  }
+
+  template <typename ValueType>
+  queue_op_status spsc_queue<ValueType>::wait_push_back(const ValueType& elem)
+  {
+    for (;;)
+    {
+      queue_op_status st = try_push_back(elem);
+      if (st != queue_op_status::full) return st;
+      wait_until_can_push();
+    }
+  }
+
+  template <typename ValueType>
+  queue_op_status spsc_queue<ValueType>::wait_push_back_from(ValueType& elem)
+  {
+    for (;;)
+    {
+      queue_op_status st = try_push_back(boost::move(elem));
+      if (st != queue_op_status::full) return st;
+      wait_until_can_push();
+    }
+  }
+
+  template <typename ValueType>
+  queue_op_status spsc_queue<ValueType>::wait_push_back(BOOST_THREAD_RV_REF(ValueType) elem)
+  {
+    return wait_push_back_from(BOOST_THREAD_RV(elem));
+  }
+
+  template <typename ValueType>
+  void spsc_queue<ValueType>::push_back(const ValueType& elem)
+  {
+    if (wait_push_back(elem) == queue_op_status::closed)
+    {
+      BOOST_THROW_EXCEPTION( sync_queue_is_closed() );
+    }
+  }
+
+  template <typename ValueType>
+  void spsc_queue<ValueType>::push_back(BOOST_THREAD_RV_REF(ValueType) elem)
+  {
+    if (wait_push_back_from(BOOST_THREAD_RV(elem)) == queue_op_status::closed)
+    {
+      BOOST_THROW_EXCEPTION( sync_queue_is_closed() );
+    }
+  }
+
+  template <typename ValueType>
+  spsc_queue<ValueType>& operator<<(spsc_queue<ValueType>& sbq, BOOST_THREAD_RV_REF(ValueType) elem)
+  {
+    sbq.push_back(boost::move(elem));
+    return sbq;
+  }
+
+  template <typename ValueType>
+  spsc_queue<ValueType>& operator<<(spsc_queue<ValueType>& sbq, ValueType const&elem)
+  {
+    sbq.push_back(elem);
+    return sbq;
+  }
+
+  template <typename ValueType>
+  spsc_queue<ValueType>& operator>>(spsc_queue<ValueType>& sbq, ValueType &elem)
+  {
+    sbq.pull_front(elem);
+    return sbq;
+  }
+
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -79,6 +79,11 @@ namespace boost
     inline queue_op_status wait_push_back(const value_type& x);
     inline queue_op_status wait_push_back(BOOST_THREAD_RV_REF(value_type) x);
 
+    template <typename InputIterator>
+    inline void push_back(InputIterator first, InputIterator last);
+    template <typename InputIterator>
+    inline queue_op_status try_push_back(InputIterator& first, InputIterator last);
+
     // Observers/Modifiers
 #ifndef BOOST_THREAD_QUEUE_DEPRECATE_OLD
     inline void pull(value_type&);
@@ -97,6 +102,13 @@ namespace boost
 
     inline queue_op_status wait_pull_front(ValueType& elem);
 
+    template <typename OutputIterator>
+    inline size_type pull_front(OutputIterator out, size_type max_n);
+    template <typename OutputIterator>
+    inline queue_op_status try_pull_front_n(OutputIterator out, size_type max_n, size_type& n);
+    template <typename OutputIterator>
+    inline queue_op_status wait_pull_front_n(OutputIterator out, size_type max_n, size_type& n);
+
   private:
     mutable mutex mtx_;
     condition_variable not_empty_;
@@ -134,10 +146,9 @@ namespace boost
     {
       return capacity_-1;
     }
-    inline size_type size(lock_guard<mutex>& lk) const BOOST_NOEXCEPT
+    inline size_type size(lock_guard<mutex>& ) const BOOST_NOEXCEPT
     {
-      if (full(lk)) return capacity(lk);
-      return ((out_+capacity(lk)-in_) % capacity(lk));
+      return ((in_+capacity_-out_) % capacity_);
     }
 
     inline void throw_if_closed(unique_lock<mutex>&);
@@ -181,6 +192,64 @@ namespace boost
         not_full_.notify_one();
       }
     }
+    /// wakes up as many waiting threads as elements have been pushed (pulled), releasing the lock once
+    inline void notify_not_empty_if_needed(unique_lock<mutex>& lk, size_type n)
+    {
+      notify_if_needed(lk, n, waiting_empty_, not_empty_);
+    }
+    inline void notify_not_full_if_needed(unique_lock<mutex>& lk, size_type n)
+    {
+      notify_if_needed(lk, n, waiting_full_, not_full_);
+    }
+    inline static void notify_if_needed(unique_lock<mutex>& lk, size_type n, size_type& waiting, condition_variable& cv)
+    {
+      if (waiting == 0 || n == 0) return;
+      if (n >= waiting)
+      {
+        waiting = 0;
+        lk.unlock();
+        cv.notify_all();
+      }
+      else
+      {
+        waiting -= n;
+        lk.unlock();
+        for (; n > 0; --n) cv.notify_one();
+      }
+    }
+
+    template <typename InputIterator>
+    inline size_type push_range(InputIterator& first, InputIterator last, unique_lock<mutex>& lk)
+    {
+      size_type n = 0;
+      try
+      {
+        for (size_type in_p_1 = inc(in_); first != last && in_p_1 != out_; ++first, in_p_1 = inc(in_), ++n)
+        {
+          data_[in_] = *first;
+          in_ = in_p_1;
+        }
+      }
+      catch (...)
+      {
+        notify_not_empty_if_needed(lk, n);
+        throw;
+      }
+      notify_not_empty_if_needed(lk, n);
+      return n;
+    }
+    template <typename OutputIterator>
+    inline size_type pull_range(OutputIterator& out, size_type max_n, unique_lock<mutex>& lk)
+    {
+      size_type n = 0;
+      for (; n < max_n && out_ != in_; ++n, ++out)
+      {
+        *out = boost::move(data_[out_]);
+        out_ = inc(out_);
+      }
+      notify_not_full_if_needed(lk, n);
+      return n;
+    }
 
 #ifndef BOOST_THREAD_QUEUE_DEPRECATE_OLD
     inline void pull(value_type& elem, unique_lock<mutex>& lk)
@@ -567,8 +636,9 @@ namespace boost
   {
     try
     {
-      if (closed(lk)) {return queue_op_status::closed;}
-      if (empty(lk)) {return queue_op_status::empty;}
+      bool is_closed = false;
+      wait_until_not_empty(lk, is_closed);
+      if (is_closed) {return queue_op_status::closed;}
       pull_front(elem, lk);
       return queue_op_status::success;
     }
@@ -638,14 +708,16 @@ namespace boost
   template <typename ValueType>
   queue_op_status sync_bounded_queue<ValueType>::wait_push_back(const ValueType& elem, unique_lock<mutex>& lk)
   {
-    if (closed(lk)) return queue_op_status::closed;
-    push_back(elem, lk);
+    bool is_closed = false;
+    size_type in_p_1 = wait_until_not_full(lk, is_closed);
+    if (is_closed) return queue_op_status::closed;
+    push_at(elem, in_p_1, lk);
     return queue_op_status::success;
   }
   template <typename ValueType>
   queue_op_status sync_bounded_queue<ValueType>::wait_push_back(const ValueType& elem)
   {
-    unique_lock<mutex>& lk(mtx_);
+    unique_lock<mutex> lk(mtx_);
     return wait_push_back(elem, lk);
   }
 
@@ -691,6 +763,21 @@ namespace boost
       not_full_.wait(lk);
     }
   }
+  template <typename ValueType>
+  typename sync_bounded_queue<ValueType>::size_type sync_bounded_queue<ValueType>::wait_until_not_full(unique_lock<mutex>& lk, bool & closed)
+  {
+    for (;;)
+    {
+      if (closed_) {closed=true; return 0;}
+      size_type in_p_1 = inc(in_);
+      if (in_p_1 != out_) // ! full()
+      {
+        return in_p_1;
+      }
+      ++waiting_full_;
+      not_full_.wait(lk);
+    }
+  }
 
 #ifndef BOOST_THREAD_QUEUE_DEPRECATE_OLD
   template <typename ValueType>
@@ -775,12 +862,9 @@ namespace boost
   template <typename ValueType>
   queue_op_status sync_bounded_queue<ValueType>::wait_push_back(BOOST_THREAD_RV_REF(ValueType) elem, unique_lock<mutex>& lk)
   {
-    if (closed(lk)) return queue_op_status::closed;
-    size_type in_p_1 = inc(in_);
-    if (in_p_1 == out_) // full()
-    {
-      return queue_op_status::full;
-    }
+    bool is_closed = false;
+    size_type in_p_1 = wait_until_not_full(lk, is_closed);
+    if (is_closed) return queue_op_status::closed;
     push_at(boost::move(elem), in_p_1, lk);
     return queue_op_status::success;
   }
@@ -788,7 +872,7 @@ namespace boost
   queue_op_status sync_bounded_queue<ValueType>::wait_push_back(BOOST_THREAD_RV_REF(ValueType) elem)
   {
       unique_lock<mutex> lk(mtx_);
-      return try_push_back(boost::move(elem), lk);
+      return wait_push_back(boost::move(elem), lk);
   }
 
 
@@ -854,6 +938,84 @@ namespace boost
     }
   }
 
+  template <typename ValueType>
+  template <typename InputIterator>
+  queue_op_status sync_bounded_queue<ValueType>::try_push_back(InputIterator& first, InputIterator last)
+  {
+    unique_lock<mutex> lk(mtx_);
+    if (closed(lk)) return queue_op_status::closed;
+    if (first == last) return queue_op_status::success;
+    if (full(lk)) return queue_op_status::full;
+    push_range(first, last, lk);
+    return (first == last) ? queue_op_status::success : queue_op_status::full;
+  }
+
+  template <typename ValueType>
+  template <typename InputIterator>
+  void sync_bounded_queue<ValueType>::push_back(InputIterator first, InputIterator last)
+  {
+    try
+    {
+      unique_lock<mutex> lk(mtx_);
+      while (first != last)
+      {
+        wait_until_not_full(lk);
+        push_range(first, last, lk);
+        if (! lk.owns_lock()) lk.lock();
+      }
+    }
+    catch (...)
+    {
+      close();
+      throw;
+    }
+  }
+
+  template <typename ValueType>
+  template <typename OutputIterator>
+  queue_op_status sync_bounded_queue<ValueType>::try_pull_front_n(OutputIterator out, size_type max_n, size_type& n)
+  {
+    n = 0;
+    unique_lock<mutex> lk(mtx_);
+    if (empty(lk))
+    {
+      if (closed(lk)) return queue_op_status::closed;
+      return queue_op_status::empty;
+    }
+    n = pull_range(out, max_n, lk);
+    return queue_op_status::success;
+  }
+
+  template <typename ValueType>
+  template <typename OutputIterator>
+  queue_op_status sync_bounded_queue<ValueType>::wait_pull_front_n(OutputIterator out, size_type max_n, size_type& n)
+  {
+    n = 0;
+    unique_lock<mutex> lk(mtx_);
+    bool is_closed = false;
+    wait_until_not_empty(lk, is_closed);
+    if (is_closed) return queue_op_status::closed;
+    n = pull_range(out, max_n, lk);
+    return queue_op_status::success;
+  }
+
+  template <typename ValueType>
+  template <typename OutputIterator>
+  typename sync_bounded_queue<ValueType>::size_type sync_bounded_queue<ValueType>::pull_front(OutputIterator out, size_type max_n)
+  {
+    try
+    {
+      unique_lock<mutex> lk(mtx_);
+      wait_until_not_empty(lk);
+      return pull_range(out, max_n, lk);
+    }
+    catch (...)
+    {
+      close();
+      throw;
+    }
+  }
+
   template <typename ValueType>
   sync_bounded_queue<ValueType>& operator<<(sync_bounded_queue<ValueType>& sbq, BOOST_THREAD_RV_REF(ValueType) elem)
   {
@@ -69,6 +69,10 @@ namespace boost
     inline queue_op_status nonblocking_push_back(BOOST_THREAD_RV_REF(value_type) x);
     inline queue_op_status wait_push_back(BOOST_THREAD_RV_REF(value_type) x);
 
+    template <typename InputIterator>
+    inline void push_back(InputIterator first, InputIterator last);
+    template <typename InputIterator>
+    inline queue_op_status try_push_back(InputIterator& first, InputIterator last);
 
     // Observers/Modifiers
 #ifndef BOOST_THREAD_QUEUE_DEPRECATE_OLD
@@ -91,6 +95,13 @@ namespace boost
     inline queue_op_status nonblocking_pull_front(value_type&);
     inline queue_op_status wait_pull_front(ValueType& elem);
 
+    template <typename OutputIterator>
+    inline size_type pull_front(OutputIterator out, size_type max_n);
+    template <typename OutputIterator>
+    inline queue_op_status try_pull_front_n(OutputIterator out, size_type max_n, size_type& n);
+    template <typename OutputIterator>
+    inline queue_op_status wait_pull_front_n(OutputIterator out, size_type max_n, size_type& n);
+
     inline underlying_queue_type underlying_queue() {
       lock_guard<mutex> lk(mtx_);
       return boost::move(data_);
@@ -145,6 +156,53 @@ namespace boost
         not_empty_.notify_one();
       }
     }
+    /// wakes up as many waiting threads as elements have been pushed, releasing the lock once
+    inline void notify_not_empty_if_needed(unique_lock<mutex>& lk, size_type n)
+    {
+      if (waiting_empty_ == 0 || n == 0) return;
+      if (n >= waiting_empty_)
+      {
+        waiting_empty_ = 0;
+        lk.unlock();
+        not_empty_.notify_all();
+      }
+      else
+      {
+        waiting_empty_ -= n;
+        lk.unlock();
+        for (; n > 0; --n) not_empty_.notify_one();
+      }
+    }
+
+    template <typename InputIterator>
+    inline void push_range(InputIterator& first, InputIterator last, unique_lock<mutex>& lk)
+    {
+      size_type n = 0;
+      try
+      {
+        for (; first != last; ++first, ++n)
+        {
+          data_.push_back(*first);
+        }
+      }
+      catch (...)
+      {
+        notify_not_empty_if_needed(lk, n);
+        throw;
+      }
+      notify_not_empty_if_needed(lk, n);
+    }
+    template <typename OutputIterator>
+    inline size_type pull_range(OutputIterator& out, size_type max_n, unique_lock<mutex>& )
+    {
+      size_type n = 0;
+      for (; n < max_n && ! data_.empty(); ++n, ++out)
+      {
+        *out = boost::move(data_.front());
+        data_.pop_front();
+      }
+      return n;
+    }
 
 #ifndef BOOST_THREAD_QUEUE_DEPRECATE_OLD
     inline void pull(value_type& elem, unique_lock<mutex>& )
@@ -316,11 +374,9 @@ namespace boost
   template <typename ValueType>
   queue_op_status sync_queue<ValueType>::wait_pull_front(ValueType& elem, unique_lock<mutex>& lk)
   {
-    if (empty(lk))
-    {
-      if (closed(lk)) return queue_op_status::closed;
-      return queue_op_status::empty;
-    }
+    bool is_closed;
+    wait_until_not_empty(lk, is_closed);
+    if (is_closed) return queue_op_status::closed;
     pull_front(elem, lk);
     return queue_op_status::success;
   }
@@ -767,6 +823,78 @@ namespace boost
     }
   }
 
+  template <typename ValueType>
+  template <typename InputIterator>
+  queue_op_status sync_queue<ValueType>::try_push_back(InputIterator& first, InputIterator last)
+  {
+    unique_lock<mutex> lk(mtx_);
+    if (closed(lk)) return queue_op_status::closed;
+    push_range(first, last, lk);
+    return queue_op_status::success;
+  }
+
+  template <typename ValueType>
+  template <typename InputIterator>
+  void sync_queue<ValueType>::push_back(InputIterator first, InputIterator last)
+  {
+    try
+    {
+      unique_lock<mutex> lk(mtx_);
+      throw_if_closed(lk);
+      push_range(first, last, lk);
+    }
+    catch (...)
+    {
+      close();
+      throw;
+    }
+  }
+
+  template <typename ValueType>
+  template <typename OutputIterator>
+  queue_op_status sync_queue<ValueType>::try_pull_front_n(OutputIterator out, size_type max_n, size_type& n)
+  {
+    n = 0;
+    unique_lock<mutex> lk(mtx_);
+    if (empty(lk))
+    {
+      if (closed(lk)) return queue_op_status::closed;
+      return queue_op_status::empty;
+    }
+    n = pull_range(out, max_n, lk);
+    return queue_op_status::success;
+  }
+
+  template <typename ValueType>
+  template <typename OutputIterator>
+  queue_op_status sync_queue<ValueType>::wait_pull_front_n(OutputIterator out, size_type max_n, size_type& n)
+  {
+    n = 0;
+    unique_lock<mutex> lk(mtx_);
+    bool is_closed;
+    wait_until_not_empty(lk, is_closed);
+    if (is_closed) return queue_op_status::closed;
+    n = pull_range(out, max_n, lk);
+    return queue_op_status::success;
+  }
+
+  template <typename ValueType>
+  template <typename OutputIterator>
+  typename sync_queue<ValueType>::size_type sync_queue<ValueType>::pull_front(OutputIterator out, size_type max_n)
+  {
+    try
+    {
+      unique_lock<mutex> lk(mtx_);
+      wait_until_not_empty(lk);
+      return pull_range(out, max_n, lk);
+    }
+    catch (...)
+    {
+      close();
+      throw;
+    }
+  }
+
   template <typename ValueType>
   sync_queue<ValueType>& operator<<(sync_queue<ValueType>& sbq, BOOST_THREAD_RV_REF(ValueType) elem)
   {
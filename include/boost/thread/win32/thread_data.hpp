@@ -36,6 +36,7 @@ namespace boost
   public:
       thread_attributes() BOOST_NOEXCEPT {
         val_.stack_size = 0;
+        val_.affinity_mask = 0;
         //val_.lpThreadAttributes=0;
       }
       ~thread_attributes() {
@@ -49,6 +50,22 @@ namespace boost
           return val_.stack_size;
       }
 
+      // affinity
+      // restricts the thread to the given cpus, or to any cpu if empty.
+      // Returns false if a cpu is out of range.
+      bool set_affinity(std::vector<unsigned> const& cpus) BOOST_NOEXCEPT {
+        std::size_t mask = 0;
+        for (std::size_t i = 0; i < cpus.size(); ++i) {
+          if (cpus[i] >= sizeof(mask) * 8) return false;
+          mask |= std::size_t(1) << cpus[i];
+        }
+        val_.affinity_mask = mask;
+        return true;
+      }
+      // restricts the thread to the cpus of the NUMA node.
+      // Returns false if \c node has no cpu.
+      bool BOOST_THREAD_DECL set_numa_node(unsigned node);
+
       //void set_security(LPSECURITY_ATTRIBUTES lpThreadAttributes)
       //{
       //  val_.lpThreadAttributes=lpThreadAttributes;
@@ -60,6 +77,8 @@ namespace boost
 
       struct win_attrs {
         std::size_t stack_size;
+        /// the cpus the thread is restricted to, none if 0.
+        std::size_t affinity_mask;
         //LPSECURITY_ATTRIBUTES lpThreadAttributes;
       };
       typedef win_attrs native_handle_type;
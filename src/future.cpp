@@ -46,6 +46,9 @@ namespace boost
         case future_errc::no_state:
             return std::string("Operation not permitted on an object without "
                           "an associated state.");
+        case future_errc::operation_cancelled:
+            return std::string("The operation has been cancelled before "
+                          "it was run.");
         }
         return std::string("unspecified future_errc value\n");
     }
@@ -627,6 +627,113 @@ namespace boost
 #endif
     }
 
+    namespace
+    {
+        // the cpus of each NUMA node, read once from sysfs.
+        std::vector<std::vector<unsigned> > numa_nodes;
+        // the NUMA node of each cpu.
+        std::vector<unsigned> numa_node_of_cpu;
+        boost::once_flag numa_nodes_init_flag=BOOST_ONCE_INIT;
+
+#ifdef __linux__
+        // parses a sysfs cpu or node list, as "0-3,8-11".
+        std::vector<unsigned> parse_list(std::string const& path)
+        {
+            std::vector<unsigned> ids;
+            std::ifstream file(path.c_str());
+            std::string line;
+            if (! getline(file, line))
+                return ids;
+            boost::trim(line);
+            if (line.empty())
+                return ids;
+            std::vector<std::string> ranges;
+            boost::split(ranges, line, boost::is_any_of(","));
+            for (std::size_t i = 0; i < ranges.size(); ++i)
+            {
+                std::vector<std::string> bounds;
+                boost::split(bounds, ranges[i], boost::is_any_of("-"));
+                unsigned first = boost::lexical_cast<unsigned>(bounds.front());
+                unsigned last = boost::lexical_cast<unsigned>(bounds.back());
+                for (unsigned id = first; id <= last; ++id)
+                    ids.push_back(id);
+            }
+            return ids;
+        }
+#endif
+
+        void init_numa_nodes()
+        {
+            try
+            {
+#ifdef __linux__
+                std::vector<unsigned> nodes = parse_list("/sys/devices/system/node/online");
+                for (std::size_t i = 0; i < nodes.size(); ++i)
+                {
+                    std::vector<unsigned> cpus = parse_list("/sys/devices/system/node/node"
+                        + boost::lexical_cast<std::string>(nodes[i]) + "/cpulist");
+                    if (numa_nodes.size() <= nodes[i])
+                        numa_nodes.resize(nodes[i] + 1);
+                    numa_nodes[nodes[i]].swap(cpus);
+                }
+#endif
+            }
+            catch (...)
+            {
+                numa_nodes.clear();
+            }
+            // Fall back to a single node with all the cpus when the topology is unknown.
+            if (numa_nodes.empty())
+            {
+                numa_nodes.resize(1);
+                for (unsigned cpu = 0; cpu < thread::hardware_concurrency(); ++cpu)
+                    numa_nodes[0].push_back(cpu);
+            }
+            for (unsigned node = 0; node < numa_nodes.size(); ++node)
+            {
+                for (std::size_t i = 0; i < numa_nodes[node].size(); ++i)
+                {
+                    unsigned cpu = numa_nodes[node][i];
+                    if (numa_node_of_cpu.size() <= cpu)
+                        numa_node_of_cpu.resize(cpu + 1, 0);
+                    numa_node_of_cpu[cpu] = node;
+                }
+            }
+        }
+    }
+
+    unsigned thread::numa_node_count() BOOST_NOEXCEPT
+    {
+        boost::call_once(numa_nodes_init_flag, init_numa_nodes);
+        return static_cast<unsigned>(numa_nodes.size());
+    }
+
+    std::vector<unsigned> thread::numa_node_cpus(unsigned node)
+    {
+        boost::call_once(numa_nodes_init_flag, init_numa_nodes);
+        return node < numa_nodes.size() ? numa_nodes[node] : std::vector<unsigned>();
+    }
+
+    bool thread_attributes::set_numa_node(unsigned node)
+    {
+        std::vector<unsigned> cpus = thread::numa_node_cpus(node);
+        return ! cpus.empty() && set_affinity(cpus);
+    }
+
+    namespace this_thread
+    {
+        unsigned get_numa_node() BOOST_NOEXCEPT
+        {
+            boost::call_once(numa_nodes_init_flag, init_numa_nodes);
+#if defined __GLIBC__ && defined _GNU_SOURCE
+            int const cpu = sched_getcpu();
+            if (cpu >= 0 && static_cast<std::size_t>(cpu) < numa_node_of_cpu.size())
+                return numa_node_of_cpu[cpu];
+#endif
+            return 0;
+        }
+    }
+
 #if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
     void thread::interrupt()
     {
@@ -259,6 +259,10 @@ namespace boost
       }
       intrusive_ptr_add_ref(thread_info.get());
       thread_info->thread_handle=(detail::win32::handle)(new_thread);
+      if (attr.native_handle()->affinity_mask != 0)
+      {
+        SetThreadAffinityMask(thread_info->thread_handle, static_cast<DWORD_PTR>(attr.native_handle()->affinity_mask));
+      }
       ResumeThread(thread_info->thread_handle);
       return true;
     }
@@ -441,6 +445,64 @@ namespace boost
         return cores;
     }
 
+    namespace
+    {
+        // the cpus of each NUMA node of the processor group of the process.
+        std::vector<std::vector<unsigned> > numa_nodes;
+        boost::once_flag numa_nodes_init_flag=BOOST_ONCE_INIT;
+
+        void init_numa_nodes()
+        {
+#if !(defined(__MINGW32__) || defined (__MINGW64__))
+            DWORD size = 0;
+            GetLogicalProcessorInformation(NULL, &size);
+            if (ERROR_INSUFFICIENT_BUFFER == GetLastError())
+            {
+                std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> buffer(size);
+                if (GetLogicalProcessorInformation(&buffer.front(), &size) != FALSE)
+                {
+                    const size_t Elements = size / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION);
+                    for (size_t i = 0; i < Elements; ++i) {
+                        if (buffer[i].Relationship != RelationNumaNode)
+                            continue;
+                        unsigned const node = buffer[i].NumaNode.NodeNumber;
+                        if (numa_nodes.size() <= node)
+                            numa_nodes.resize(node + 1);
+                        for (unsigned cpu = 0; cpu < sizeof(ULONG_PTR) * 8; ++cpu)
+                            if (buffer[i].ProcessorMask & (ULONG_PTR(1) << cpu))
+                                numa_nodes[node].push_back(cpu);
+                    }
+                }
+            }
+#endif
+            // Fall back to a single node with all the cpus when the topology is unknown.
+            if (numa_nodes.empty())
+            {
+                numa_nodes.resize(1);
+                for (unsigned cpu = 0; cpu < thread::hardware_concurrency(); ++cpu)
+                    numa_nodes[0].push_back(cpu);
+            }
+        }
+    }
+
+    unsigned thread::numa_node_count() BOOST_NOEXCEPT
+    {
+        boost::call_once(numa_nodes_init_flag, init_numa_nodes);
+        return static_cast<unsigned>(numa_nodes.size());
+    }
+
+    std::vector<unsigned> thread::numa_node_cpus(unsigned node)
+    {
+        boost::call_once(numa_nodes_init_flag, init_numa_nodes);
+        return node < numa_nodes.size() ? numa_nodes[node] : std::vector<unsigned>();
+    }
+
+    bool thread_attributes::set_numa_node(unsigned node)
+    {
+        std::vector<unsigned> cpus = thread::numa_node_cpus(node);
+        return ! cpus.empty() && set_affinity(cpus);
+    }
+
     thread::native_handle_type thread::native_handle()
     {
         detail::thread_data_ptr local_thread_info=(get_thread_info)();
@@ -454,6 +516,18 @@ namespace boost
 
     namespace this_thread
     {
+        unsigned get_numa_node() BOOST_NOEXCEPT
+        {
+            boost::call_once(numa_nodes_init_flag, init_numa_nodes);
+#if _WIN32_WINNT >= 0x0600
+            unsigned const cpu = GetCurrentProcessorNumber();
+            for (unsigned node = 0; node < numa_nodes.size(); ++node)
+                if (std::find(numa_nodes[node].begin(), numa_nodes[node].end(), cpu) != numa_nodes[node].end())
+                    return node;
+#endif
+            return 0;
+        }
+
         namespace
         {
             LARGE_INTEGER get_due_time(detail::timeout const&  target_time)
@@ -0,0 +1,74 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// template <class F, class... Args>
+//     future<typename result_of<F(Args...)>::type>
+//     async(launch policy, F&& f, Args&&... args);
+//
+// with BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR, a function running on the default executor can wait for the
+// async() calls it makes even when all the threads of the pool are busy.
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_FUTURE_USES_DEFAULT_EXECUTOR
+#define BOOST_THREAD_DEFAULT_EXECUTOR_THREAD_COUNT 1
+
+#include <boost/thread/future.hpp>
+#include <boost/bind.hpp>
+#include <boost/atomic.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+boost::atomic<int> calls(0);
+
+int leaf()
+{
+  ++calls;
+  return 1;
+}
+
+int nested(int depth)
+{
+  if (depth == 0) return leaf();
+  boost::future<int> f = boost::async(boost::launch::async, boost::bind(&nested, depth - 1));
+  return f.get() + 1;
+}
+
+void discard()
+{
+  // the future is destroyed at once
+  boost::async(boost::launch::async, &leaf);
+  ++calls;
+}
+
+int from_function_pointer()
+{
+  return boost::async(boost::launch::async, &leaf).get();
+}
+
+int main()
+{
+  {
+    // the nested calls run on the single thread of the pool
+    calls = 0;
+    boost::future<int> f = boost::async(boost::launch::async, boost::bind(&nested, 8));
+    BOOST_TEST_EQ(f.get(), 9);
+    BOOST_TEST_EQ(calls, 1);
+  }
+  {
+    calls = 0;
+    boost::async(boost::launch::async, &discard).get();
+    // the single thread of the pool runs the discarded call before this one
+    boost::async(boost::launch::async, &leaf).get();
+    BOOST_TEST_EQ(calls, 3);
+  }
+  {
+    calls = 0;
+    BOOST_TEST_EQ(boost::async(boost::launch::async, &from_function_pointer).get(), 1);
+    BOOST_TEST_EQ(calls, 1);
+  }
+
+  return boost::report_errors();
+}
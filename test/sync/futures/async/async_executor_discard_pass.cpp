@@ -0,0 +1,94 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// template <class Executor, class F, class... Args>
+//     future<typename result_of<F(Args...)>::type>
+//     async(Executor& ex, F&& f, Args&&... args);
+//
+// discarding the future doesn't wait for the task, which basic_thread_pool::wait_idle() drains.
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/bind.hpp>
+#include <boost/atomic.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+boost::atomic<int> calls(0);
+boost::shared_future<void> gate;
+
+int p1()
+{
+  gate.wait();
+  ++calls;
+  return 1;
+}
+
+void v1()
+{
+  gate.wait();
+  ++calls;
+}
+
+void resubmit(boost::basic_thread_pool* ex)
+{
+  ++calls;
+  ex->submit(&v1);
+}
+
+int main()
+{
+  {
+    // the futures are discarded while their tasks are blocked
+    calls = 0;
+    boost::promise<void> open;
+    gate = open.get_future().share();
+    boost::basic_thread_pool ex(2);
+    for (int i = 0; i < 10; ++i)
+    {
+      boost::async(ex, &p1);
+      boost::async(ex, &v1);
+    }
+    BOOST_TEST_EQ(calls, 0);
+    open.set_value();
+    ex.wait_idle();
+    BOOST_TEST_EQ(calls, 20);
+  }
+  {
+    // the pool completes the discarded tasks before being destroyed
+    calls = 0;
+    boost::promise<void> open;
+    gate = open.get_future().share();
+    {
+      boost::basic_thread_pool ex(1);
+      boost::async(ex, &p1);
+      open.set_value();
+    }
+    BOOST_TEST_EQ(calls, 1);
+  }
+  {
+    // wait_idle() waits for the closures submitted by the closures
+    calls = 0;
+    boost::promise<void> open;
+    gate = open.get_future().share();
+    open.set_value();
+    boost::basic_thread_pool ex(2);
+    for (int i = 0; i < 10; ++i)
+    {
+      ex.submit(boost::bind(&resubmit, &ex));
+    }
+    ex.wait_idle();
+    BOOST_TEST_EQ(calls, 20);
+    ex.wait_idle();
+    boost::future<int> f = boost::async(ex, &p1);
+    BOOST_TEST_EQ(f.get(), 1);
+  }
+
+  return boost::report_errors();
+}
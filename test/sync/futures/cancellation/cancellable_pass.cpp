@@ -0,0 +1,145 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/cancellation.hpp>
+
+// template <class F>
+// unspecified cancellable(cancellation_token const& tk, F&& f);
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/cancellation.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/atomic.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+boost::atomic<int> calls(0);
+
+int p1()
+{
+  ++calls;
+  return 1;
+}
+
+void v1()
+{
+  ++calls;
+}
+
+boost::shared_future<void> gate;
+
+// blocks the only thread of the pool until the gate is opened.
+void block()
+{
+  gate.wait();
+}
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION && ! defined BOOST_NO_CXX11_VARIADIC_TEMPLATES && ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+int p2(boost::future<int> f)
+{
+  ++calls;
+  return 2 * f.get();
+}
+#endif
+
+template <typename T>
+bool is_cancelled(boost::future<T>& f)
+{
+  try
+  {
+    f.get();
+    return false;
+  }
+  catch (boost::future_cancelled&)
+  {
+    return true;
+  }
+}
+
+int main()
+{
+#if ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+  // async() accepts function objects only with rvalue references.
+  {
+    boost::cancellation_source src;
+    boost::future<int> f = boost::async(boost::launch::async, boost::cancellable(src.get_token(), &p1));
+    BOOST_TEST_EQ(f.get(), 1);
+  }
+  {
+    calls = 0;
+    boost::cancellation_source src;
+    src.cancel();
+    boost::future<int> f = boost::async(boost::launch::async, boost::cancellable(src.get_token(), &p1));
+    BOOST_TEST(is_cancelled(f));
+    BOOST_TEST_EQ(calls, 0);
+  }
+  {
+    // the queued work is dropped once cancelled, and its future made ready
+    calls = 0;
+    boost::promise<void> open;
+    gate = open.get_future().share();
+    boost::basic_thread_pool ex(1);
+    boost::cancellation_source src;
+    ex.submit(&block);
+    boost::future<int> f1 = boost::async(ex, boost::cancellable(src.get_token(), &p1));
+    ex.submit(boost::cancellable(src.get_token(), &v1));
+    boost::future<int> f2 = boost::async(ex, &p1);
+    src.cancel();
+    open.set_value();
+    BOOST_TEST(is_cancelled(f1));
+    BOOST_TEST_EQ(f2.get(), 1);
+    BOOST_TEST_EQ(calls, 1);
+  }
+#endif
+  {
+    // the queued closure is dropped once cancelled
+    calls = 0;
+    boost::promise<void> open;
+    gate = open.get_future().share();
+    {
+      boost::basic_thread_pool ex(1);
+      boost::cancellation_source src;
+      ex.submit(&block);
+      ex.submit(boost::cancellable(src.get_token(), &v1));
+      ex.submit(&v1);
+      src.cancel();
+      open.set_value();
+    }
+    BOOST_TEST_EQ(calls, 1);
+  }
+  {
+    calls = 0;
+    boost::cancellation_source src;
+    boost::packaged_task<int()> pt(boost::cancellable(src.get_token(), &p1));
+    boost::future<int> f = pt.get_future();
+    src.cancel();
+    pt();
+    BOOST_TEST(is_cancelled(f));
+    BOOST_TEST_EQ(calls, 0);
+  }
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION && ! defined BOOST_NO_CXX11_VARIADIC_TEMPLATES && ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+  {
+    // the rest of a chain is dropped once cancelled
+    calls = 0;
+    boost::cancellation_source src;
+    boost::cancellation_token tk = src.get_token();
+    boost::promise<int> p;
+    boost::future<int> f1 = p.get_future().then(boost::launch::sync, boost::cancellable(tk, &p2));
+    boost::future<int> f2 = f1.then(boost::launch::sync, boost::cancellable(tk, &p2));
+    src.cancel();
+    p.set_value(1);
+    BOOST_TEST(is_cancelled(f2));
+    BOOST_TEST_EQ(calls, 0);
+  }
+  {
+    boost::cancellation_source src;
+    boost::future<int> f = boost::make_ready_future(1).then(boost::launch::async, boost::cancellable(src.get_token(), &p2));
+    BOOST_TEST_EQ(f.get(), 2);
+  }
+#endif
+
+  return boost::report_errors();
+}
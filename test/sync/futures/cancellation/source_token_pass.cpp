@@ -0,0 +1,56 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/cancellation.hpp>
+
+// class cancellation_source;
+// class cancellation_token;
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/cancellation.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+int main()
+{
+  {
+    boost::cancellation_token tk;
+    BOOST_TEST(! tk.can_be_cancelled());
+    BOOST_TEST(! tk.is_cancelled());
+    tk.throw_if_cancelled();
+  }
+  {
+    boost::cancellation_source src;
+    boost::cancellation_token tk = src.get_token();
+    BOOST_TEST(tk.can_be_cancelled());
+    BOOST_TEST(! tk.is_cancelled());
+    BOOST_TEST(! src.is_cancelled());
+    src.cancel();
+    BOOST_TEST(src.is_cancelled());
+    BOOST_TEST(tk.is_cancelled());
+    try
+    {
+      tk.throw_if_cancelled();
+      BOOST_TEST(false);
+    }
+    catch (boost::future_cancelled& ex)
+    {
+      BOOST_TEST(ex.code() == boost::system::make_error_code(boost::future_errc::operation_cancelled));
+    }
+  }
+  {
+    // the copies of a source share its state
+    boost::cancellation_source src;
+    boost::cancellation_source copy = src;
+    boost::cancellation_token tk = src.get_token();
+    copy.cancel();
+    BOOST_TEST(src.is_cancelled());
+    BOOST_TEST(tk.is_cancelled());
+    // a new source is not cancelled
+    BOOST_TEST(! boost::cancellation_source().get_token().is_cancelled());
+  }
+
+  return boost::report_errors();
+}
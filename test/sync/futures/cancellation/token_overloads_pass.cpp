@@ -0,0 +1,193 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/cancellation.hpp>
+
+// template <class F>
+// packaged_task(cancellation_token tk, F&& f);
+// template <class F>
+// future<R> async(cancellation_token tk, launch policy, F&& f);
+// template <class Executor, class F>
+// future<R> async(cancellation_token tk, Executor& ex, F&& f);
+// template <class F>
+// future<R2> future<R>::then(cancellation_token tk, launch policy, F&& func);
+// template <class Executor, class F>
+// future<R2> future<R>::then(cancellation_token tk, Executor& ex, F&& func);
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/cancellation.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/atomic.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+boost::atomic<int> calls(0);
+
+int p1()
+{
+  ++calls;
+  return 1;
+}
+
+boost::shared_future<void> gate;
+
+// blocks the only thread of the pool until the gate is opened.
+void block()
+{
+  gate.wait();
+}
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION && ! defined BOOST_NO_CXX11_VARIADIC_TEMPLATES && ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+int p2(boost::future<int> f)
+{
+  ++calls;
+  return 2 * f.get();
+}
+
+int p3(boost::shared_future<int> f)
+{
+  ++calls;
+  return 3 * f.get();
+}
+#endif
+
+template <typename T>
+bool is_cancelled(boost::future<T>& f)
+{
+  try
+  {
+    f.get();
+    return false;
+  }
+  catch (boost::future_cancelled&)
+  {
+    return true;
+  }
+}
+
+int main()
+{
+  {
+    calls = 0;
+    boost::cancellation_source src;
+    boost::packaged_task<int()> pt(src.get_token(), &p1);
+    boost::future<int> f = pt.get_future();
+    pt();
+    BOOST_TEST_EQ(f.get(), 1);
+    BOOST_TEST_EQ(calls, 1);
+  }
+  {
+    // the future is cancelled without invoking the task, which is then dropped
+    calls = 0;
+    boost::cancellation_source src;
+    boost::packaged_task<int()> pt(src.get_token(), &p1);
+    boost::future<int> f = pt.get_future();
+    src.cancel();
+    BOOST_TEST(f.is_ready());
+    pt();
+    BOOST_TEST(is_cancelled(f));
+    BOOST_TEST_EQ(calls, 0);
+  }
+  {
+    // a task never invoked is cancelled rather than broken
+    boost::cancellation_source src;
+    boost::future<int> f;
+    {
+      boost::packaged_task<int()> pt(src.get_token(), &p1);
+      f = pt.get_future();
+      src.cancel();
+    }
+    BOOST_TEST(is_cancelled(f));
+  }
+#if ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+  {
+    boost::cancellation_source src;
+    boost::future<int> f = boost::async(src.get_token(), boost::launch::async, &p1);
+    BOOST_TEST_EQ(f.get(), 1);
+  }
+  {
+    calls = 0;
+    boost::cancellation_source src;
+    src.cancel();
+    boost::future<int> f = boost::async(src.get_token(), boost::launch::async, &p1);
+    BOOST_TEST(is_cancelled(f));
+    BOOST_TEST_EQ(calls, 0);
+  }
+  {
+    // a deferred task is not run once cancelled
+    calls = 0;
+    boost::cancellation_source src;
+    boost::future<int> f = boost::async(src.get_token(), boost::launch::deferred, &p1);
+    src.cancel();
+    BOOST_TEST(f.is_ready());
+    BOOST_TEST(is_cancelled(f));
+    BOOST_TEST_EQ(calls, 0);
+  }
+  {
+    // the queued work is dropped and its future made ready before the executor reaches it
+    calls = 0;
+    boost::promise<void> open;
+    gate = open.get_future().share();
+    boost::basic_thread_pool ex(1);
+    boost::cancellation_source src;
+    ex.submit(&block);
+    boost::future<int> f1 = boost::async(src.get_token(), ex, &p1);
+    boost::future<int> f2 = boost::async(ex, &p1);
+    src.cancel();
+    BOOST_TEST(f1.is_ready());
+    BOOST_TEST(is_cancelled(f1));
+    open.set_value();
+    BOOST_TEST_EQ(f2.get(), 1);
+    BOOST_TEST_EQ(calls, 1);
+  }
+#endif
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION && ! defined BOOST_NO_CXX11_VARIADIC_TEMPLATES && ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+  {
+    boost::cancellation_source src;
+    boost::future<int> f = boost::make_ready_future(1).then(src.get_token(), boost::launch::sync, &p2);
+    BOOST_TEST_EQ(f.get(), 2);
+  }
+  {
+    // the continuation of a parent that never becomes ready is cancelled
+    calls = 0;
+    boost::cancellation_source src;
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future().then(src.get_token(), boost::launch::async, &p2);
+    src.cancel();
+    BOOST_TEST(is_cancelled(f));
+    BOOST_TEST_EQ(calls, 0);
+  }
+  {
+    calls = 0;
+    boost::cancellation_source src;
+    boost::promise<int> p;
+    boost::shared_future<int> sf = p.get_future().share();
+    boost::future<int> f = sf.then(src.get_token(), boost::launch::sync, &p3);
+    src.cancel();
+    BOOST_TEST(is_cancelled(f));
+    p.set_value(1);
+    BOOST_TEST_EQ(calls, 0);
+  }
+  {
+    // a continuation queued on an executor is dropped once cancelled
+    calls = 0;
+    boost::promise<void> open;
+    gate = open.get_future().share();
+    {
+      boost::basic_thread_pool ex(1);
+      boost::cancellation_source src;
+      ex.submit(&block);
+      boost::future<int> f = boost::make_ready_future(1).then(src.get_token(), ex, &p2);
+      src.cancel();
+      BOOST_TEST(is_cancelled(f));
+      open.set_value();
+    }
+    BOOST_TEST_EQ(calls, 0);
+  }
+#endif
+
+  return boost::report_errors();
+}
@@ -0,0 +1,173 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future_coroutine.hpp>
+
+// template <class R>
+// unspecified operator co_await(future<R>&& f);
+// template <class Ex, class R>
+// unspecified resume_on(Ex& ex, future<R>&& f);
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/future_coroutine.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/executors/loop_executor.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_COROUTINES
+
+#include <coroutine>
+
+// the coroutine type used to drive the awaiters from the test, storing the result in a promise.
+struct fire_and_forget
+{
+  struct promise_type
+  {
+    fire_and_forget get_return_object() { return fire_and_forget(); }
+    std::suspend_never initial_suspend() noexcept { return std::suspend_never(); }
+    std::suspend_never final_suspend() noexcept { return std::suspend_never(); }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+int p1()
+{
+  boost::this_thread::sleep_for(boost::chrono::milliseconds(100));
+  return 1;
+}
+
+int thr()
+{
+  throw std::logic_error("thr");
+}
+
+fire_and_forget add_one(boost::future<int> f, boost::promise<int>& res)
+{
+  int i = co_await boost::move(f);
+  res.set_value(i + 1);
+}
+
+template <typename Ex>
+fire_and_forget add_one_on(Ex& ex, boost::future<int> f, boost::promise<boost::thread::id>& where, boost::promise<int>& res)
+{
+  int i = co_await boost::resume_on(ex, boost::move(f));
+  where.set_value(boost::this_thread::get_id());
+  res.set_value(i + 1);
+}
+
+fire_and_forget catch_exception(boost::future<int> f, boost::promise<bool>& res)
+{
+  try
+  {
+    co_await boost::move(f);
+    res.set_value(false);
+  }
+  catch (std::logic_error&)
+  {
+    res.set_value(true);
+  }
+}
+
+fire_and_forget add_shared(boost::shared_future<int> f, boost::promise<int>& res)
+{
+  int i = co_await f;
+  int j = co_await f;
+  res.set_value(i + j);
+}
+
+int main()
+{
+  {
+    // ready future: no suspension
+    boost::promise<int> res;
+    add_one(boost::make_ready_future(1), res);
+    BOOST_TEST(res.get_future().is_ready());
+  }
+  {
+    boost::promise<int> res;
+    boost::future<int> r = res.get_future();
+    add_one(boost::async(boost::launch::async, &p1), res);
+    BOOST_TEST_EQ(r.get(), 2);
+  }
+  {
+    // a deferred future is run in the coroutine
+    boost::promise<int> res;
+    boost::future<int> r = res.get_future();
+    add_one(boost::async(boost::launch::deferred, &p1), res);
+    BOOST_TEST(r.is_ready());
+    BOOST_TEST_EQ(r.get(), 2);
+  }
+  {
+    boost::promise<bool> res;
+    boost::future<bool> r = res.get_future();
+    catch_exception(boost::async(boost::launch::async, &thr), res);
+    BOOST_TEST(r.get());
+  }
+  {
+    boost::promise<int> p;
+    boost::promise<int> res;
+    boost::future<int> r = res.get_future();
+    add_shared(p.get_future().share(), res);
+    BOOST_TEST(! r.is_ready());
+    p.set_value(2);
+    BOOST_TEST_EQ(r.get(), 4);
+  }
+  {
+    // resumed on the thread of a thread pool
+    boost::basic_thread_pool ex(1);
+    boost::promise<boost::thread::id> where;
+    boost::promise<int> res;
+    boost::future<boost::thread::id> w = where.get_future();
+    boost::future<int> r = res.get_future();
+    add_one_on(ex, boost::async(boost::launch::async, &p1), where, res);
+    BOOST_TEST_EQ(r.get(), 2);
+    BOOST_TEST(w.get() != boost::this_thread::get_id());
+  }
+  {
+    // resumed by the thread running the loop_executor
+    boost::loop_executor ex;
+    boost::promise<int> p;
+    boost::promise<boost::thread::id> where;
+    boost::promise<int> res;
+    boost::future<boost::thread::id> w = where.get_future();
+    boost::future<int> r = res.get_future();
+    add_one_on(ex, p.get_future(), where, res);
+    p.set_value(1);
+    BOOST_TEST(! r.is_ready());
+    while (ex.try_executing_one())
+    {
+    }
+    BOOST_TEST_EQ(r.get(), 2);
+    BOOST_TEST(w.get() == boost::this_thread::get_id());
+  }
+  {
+    // resumed by the thread making the future ready when the executor is closed
+    boost::basic_thread_pool ex(1);
+    boost::promise<int> p;
+    boost::promise<boost::thread::id> where;
+    boost::promise<int> res;
+    boost::future<boost::thread::id> w = where.get_future();
+    boost::future<int> r = res.get_future();
+    add_one_on(ex, p.get_future(), where, res);
+    ex.close();
+    p.set_value(1);
+    BOOST_TEST(r.is_ready());
+    BOOST_TEST_EQ(r.get(), 2);
+    BOOST_TEST(w.get() == boost::this_thread::get_id());
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
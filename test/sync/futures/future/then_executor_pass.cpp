@@ -0,0 +1,121 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// class future<R>
+
+// template<typename Ex, typename F>
+// auto then(Ex& ex, F&& func) -> future<decltype(func(*this))>;
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+
+int p1()
+{
+  boost::this_thread::sleep_for(boost::chrono::milliseconds(200));
+  return 1;
+}
+
+int p2(boost::future<int> f)
+{
+  BOOST_TEST(f.valid());
+  int i = f.get();
+  return 2 * i;
+}
+
+void p3(boost::future<int> f)
+{
+  BOOST_TEST(f.valid());
+  int i = f.get();
+  BOOST_TEST_EQ(i, 1);
+}
+
+int p4(boost::future<int> f)
+{
+  f.get();
+  throw std::logic_error("p4");
+}
+
+int main()
+{
+  {
+    boost::basic_thread_pool ex(2);
+    boost::future<int> f1 = boost::async(ex, &p1);
+    BOOST_TEST(f1.valid());
+    boost::future<int> f2 = f1.then(ex, &p2);
+    BOOST_TEST(f2.valid());
+    BOOST_TEST(! f1.valid());
+    BOOST_TEST_EQ(f2.get(), 2);
+  }
+  {
+    boost::basic_thread_pool ex(2);
+    boost::future<int> f1 = boost::async(ex, &p1);
+    boost::future<void> f2 = f1.then(ex, &p3);
+    BOOST_TEST(f2.valid());
+    f2.get();
+  }
+  {
+    // the continuation is submitted at once when the parent is already ready
+    boost::basic_thread_pool ex(2);
+    boost::future<int> f1 = boost::make_ready_future(1);
+    boost::future<int> f2 = f1.then(ex, &p2);
+    BOOST_TEST_EQ(f2.get(), 2);
+  }
+  {
+    boost::basic_thread_pool ex(2);
+    boost::future<int> f1 = boost::async(ex, &p1);
+    boost::future<int> f2 = f1.then(ex, &p2).then(ex, &p2).then(ex, &p2);
+    BOOST_TEST_EQ(f2.get(), 8);
+  }
+  {
+    boost::basic_thread_pool ex(2);
+    boost::future<int> f1 = boost::async(ex, &p1);
+    boost::future<int> f2 = f1.then(ex, &p4);
+    try
+    {
+      f2.get();
+      BOOST_TEST(false);
+    }
+    catch (std::logic_error&)
+    {
+    }
+  }
+  {
+    // a closed executor can't run the continuation, the exception is stored in the future
+    boost::basic_thread_pool ex(2);
+    ex.close();
+    boost::future<int> f1 = boost::make_ready_future(1);
+    boost::future<int> f2 = f1.then(ex, &p2);
+    try
+    {
+      f2.get();
+      BOOST_TEST(false);
+    }
+    catch (boost::sync_queue_is_closed&)
+    {
+    }
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
@@ -0,0 +1,155 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// class future<R>
+
+// template<typename F>
+// auto then(launch::sync, F&& func) -> future<decltype(func(*this))>;
+
+#define BOOST_THREAD_VERSION 4
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#include <boost/thread/future.hpp>
+#include <boost/optional.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+
+boost::optional<boost::thread::id> completing_thread;
+
+int p1()
+{
+  boost::this_thread::sleep_for(boost::chrono::milliseconds(200));
+  completing_thread.emplace(boost::this_thread::get_id());
+  return 1;
+}
+
+int p2(boost::future<int> f)
+{
+  BOOST_TEST(f.valid());
+  BOOST_TEST(f.is_ready());
+  int i = f.get();
+  return 2 * i;
+}
+
+int p2_on_completing_thread(boost::future<int> f)
+{
+  BOOST_TEST(completing_thread && boost::this_thread::get_id() == *completing_thread);
+  return 2 * f.get();
+}
+
+void p3(boost::future<int> f)
+{
+  BOOST_TEST(f.valid());
+  int i = f.get();
+  BOOST_TEST_EQ(i, 1);
+}
+
+int p4(boost::future<int> f)
+{
+  f.get();
+  throw std::logic_error("p4");
+}
+
+int p5(boost::future<int> f)
+{
+  return f.get() + 1;
+}
+
+int sp5(boost::shared_future<int> f)
+{
+  return f.get() + 1;
+}
+
+int main()
+{
+  {
+    boost::promise<int> p;
+    boost::future<int> f1 = p.get_future();
+    boost::future<int> f2 = f1.then(boost::launch::sync, &p2);
+    BOOST_TEST(f2.valid());
+    BOOST_TEST(! f1.valid());
+    BOOST_TEST(! f2.is_ready());
+    p.set_value(1);
+    // the continuation has been run by set_value
+    BOOST_TEST(f2.is_ready());
+    BOOST_TEST_EQ(f2.get(), 2);
+  }
+  {
+    // the continuation of a ready future is run by then()
+    boost::future<int> f2 = boost::make_ready_future(1).then(boost::launch::sync, &p2);
+    BOOST_TEST(f2.is_ready());
+    BOOST_TEST_EQ(f2.get(), 2);
+  }
+  {
+    boost::future<int> f1 = boost::async(boost::launch::async, &p1);
+    boost::future<int> f2 = f1.then(boost::launch::sync, &p2_on_completing_thread);
+    BOOST_TEST_EQ(f2.get(), 2);
+  }
+  {
+    boost::promise<int> p;
+    boost::future<void> f2 = p.get_future().then(boost::launch::sync, &p3);
+    p.set_value(1);
+    BOOST_TEST(f2.is_ready());
+    f2.get();
+  }
+  {
+    boost::promise<int> p;
+    boost::future<int> f2 = p.get_future().then(boost::launch::sync, &p4);
+    p.set_value(1);
+    try
+    {
+      f2.get();
+      BOOST_TEST(false);
+    }
+    catch (std::logic_error&)
+    {
+    }
+  }
+  {
+    // a chain of inline continuations, and then() without policy inheriting it
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future().then(boost::launch::sync, &p5).then(&p5).then(boost::launch::sync, &p5);
+    BOOST_TEST(! f.is_ready());
+    p.set_value(1);
+    BOOST_TEST(f.is_ready());
+    BOOST_TEST_EQ(f.get(), 4);
+  }
+  {
+    // a long chain is run in a loop, not nested in the completion of each stage
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future();
+    for (int i = 0; i < 100000; ++i)
+    {
+      f = f.then(boost::launch::sync, &p5);
+    }
+    p.set_value(0);
+    BOOST_TEST_EQ(f.get(), 100000);
+  }
+  {
+    boost::promise<int> p;
+    boost::shared_future<int> sf = p.get_future().share();
+    boost::future<int> f2 = boost::shared_future<int>(sf).then(boost::launch::sync, &sp5);
+    boost::future<int> f3 = boost::shared_future<int>(sf).then(boost::launch::sync, &sp5);
+    p.set_value(1);
+    BOOST_TEST_EQ(f2.get(), 2);
+    BOOST_TEST_EQ(f3.get(), 2);
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
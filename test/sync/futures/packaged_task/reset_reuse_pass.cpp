@@ -0,0 +1,125 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+// class packaged_task<R>
+
+// void reset();
+//
+// reuses the shared state when no future refers to it anymore.
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/future.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <cstdlib>
+#include <new>
+
+int allocations = 0;
+
+#if defined BOOST_NO_CXX11_NOEXCEPT
+void* operator new(std::size_t n) throw(std::bad_alloc)
+#else
+void* operator new(std::size_t n)
+#endif
+{
+  ++allocations;
+  if (void* p = std::malloc(n ? n : 1))
+    return p;
+  throw std::bad_alloc();
+}
+// not inlined, so that the compiler doesn't see free() called on the blocks of operator new.
+BOOST_NOINLINE void operator delete(void* p) BOOST_NOEXCEPT_OR_NOTHROW
+{
+  std::free(p);
+}
+BOOST_NOINLINE void operator delete(void* p, std::size_t) BOOST_NOEXCEPT_OR_NOTHROW
+{
+  std::free(p);
+}
+
+int calls = 0;
+
+void job()
+{
+  ++calls;
+}
+
+int value()
+{
+  return ++calls;
+}
+
+int main()
+{
+  {
+    // the state is reused once the future is released, so that re-arming the task doesn't allocate
+    boost::packaged_task<void()> p(&job);
+    calls = 0;
+    for (int i = 0; i < 2; ++i)
+    {
+      boost::future<void> f = p.get_future();
+      p();
+      f.get();
+      p.reset();
+    }
+    int before = allocations;
+    for (int i = 0; i < 100; ++i)
+    {
+      boost::future<void> f = p.get_future();
+      BOOST_TEST(! f.is_ready());
+      p();
+      BOOST_TEST(f.is_ready());
+      f.get();
+      p.reset();
+    }
+    BOOST_TEST_EQ(allocations, before);
+    BOOST_TEST_EQ(calls, 102);
+  }
+  {
+    // the results and exceptions of the previous runs are cleared
+    calls = 0;
+    boost::packaged_task<int()> p(&value);
+    for (int i = 1; i < 10; ++i)
+    {
+      boost::future<int> f = p.get_future();
+      BOOST_TEST(! f.is_ready());
+      p();
+      BOOST_TEST_EQ(f.get(), i);
+      f = boost::future<int>();
+      p.reset();
+    }
+  }
+  {
+    // a state still referred by a future is replaced
+    calls = 0;
+    boost::packaged_task<int()> p(&value);
+    boost::future<int> f1 = p.get_future();
+    p.reset();
+    boost::future<int> f2 = p.get_future();
+    p();
+    BOOST_TEST_EQ(f2.get(), 1);
+    try
+    {
+      f1.get();
+      BOOST_TEST(false);
+    }
+    catch (boost::broken_promise&)
+    {
+    }
+  }
+  {
+    // a state reset before running is reused too
+    calls = 0;
+    boost::packaged_task<int()> p(&value);
+    p.get_future();
+    p.reset();
+    boost::future<int> f = p.get_future();
+    p();
+    BOOST_TEST_EQ(f.get(), 1);
+  }
+
+  return boost::report_errors();
+}
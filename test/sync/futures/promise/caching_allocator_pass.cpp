@@ -0,0 +1,131 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// class promise<R>
+
+//   promise(allocator_arg_t, const caching_allocator<T>& a);
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_FUTURE_USES_CACHING_ALLOCATOR
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/caching_allocator.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#include <cstdlib>
+#include <new>
+
+// the global allocations large enough to hold a shared state, i.e. the ones that didn't go through the cache.
+unsigned long shared_state_allocations = 0;
+
+#if defined BOOST_NO_CXX11_NOEXCEPT
+void* operator new(std::size_t size) throw(std::bad_alloc)
+#else
+void* operator new(std::size_t size)
+#endif
+{
+  if (size >= sizeof(boost::detail::shared_state_base)) ++shared_state_allocations;
+  void* p = std::malloc(size ? size : 1);
+  if (! p) throw std::bad_alloc();
+  return p;
+}
+// not inlined, so that the compiler doesn't see free() called on the blocks of operator new.
+BOOST_NOINLINE void operator delete(void* p) BOOST_NOEXCEPT_OR_NOTHROW
+{
+  std::free(p);
+}
+BOOST_NOINLINE void operator delete(void* p, std::size_t) BOOST_NOEXCEPT_OR_NOTHROW
+{
+  std::free(p);
+}
+
+int f1()
+{
+  return 1;
+}
+
+int main()
+{
+  {
+    // a freed block is reused by the next allocation of the same size on the same thread
+    boost::caching_allocator<double> a;
+    double* p = a.allocate(3);
+    a.deallocate(p, 3);
+    double* q = a.allocate(3);
+    BOOST_TEST(p == q);
+    a.deallocate(q, 3);
+    BOOST_TEST(a == boost::caching_allocator<int>());
+  }
+  {
+    // large blocks are not cached but are still usable
+    boost::caching_allocator<char> a;
+    char* p = a.allocate(4096);
+    p[4095] = 'a';
+    a.deallocate(p, 4096);
+  }
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CTOR_ALLOCATORS
+  {
+    boost::promise<int> p(boost::allocator_arg, boost::caching_allocator<int>());
+    boost::future<int> f = p.get_future();
+    p.set_value(3);
+    BOOST_TEST_EQ(f.get(), 3);
+  }
+  {
+    boost::promise<void> p(boost::allocator_arg, boost::caching_allocator<void>());
+    boost::future<void> f = p.get_future();
+    p.set_value();
+    f.get();
+  }
+#endif
+  {
+    // the shared states created without allocator go through the cache
+    for (int i = 0; i < 100; ++i)
+    {
+      boost::promise<int> p;
+      boost::future<int> f = p.get_future();
+      p.set_value(i);
+      BOOST_TEST_EQ(f.get(), i);
+    }
+  }
+  {
+    // once warmed up, the shared states of promise and packaged_task are taken from the cache only
+    for (int i = 0; i < 10; ++i)
+    {
+      boost::promise<int> p;
+      boost::future<int> f = p.get_future();
+      p.set_value(i);
+      boost::packaged_task<int()> t(&f1);
+      boost::future<int> g = t.get_future();
+      t();
+      BOOST_TEST_EQ(f.get() + g.get(), i + 1);
+    }
+    unsigned long const warm = shared_state_allocations;
+    for (int i = 0; i < 1000; ++i)
+    {
+      boost::promise<int> p;
+      boost::future<int> f = p.get_future();
+      p.set_value(i);
+      boost::packaged_task<int()> t(&f1);
+      boost::future<int> g = t.get_future();
+      t();
+      BOOST_TEST_EQ(f.get() + g.get(), i + 1);
+    }
+    BOOST_TEST_EQ(shared_state_allocations, warm);
+  }
+  {
+    boost::future<int> f = boost::async(boost::launch::async, &f1);
+    BOOST_TEST_EQ(f.get(), 1);
+  }
+  {
+    boost::packaged_task<int()> t(&f1);
+    boost::future<int> f = t.get_future();
+    t();
+    BOOST_TEST_EQ(f.get(), 1);
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,83 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/promise_batch.hpp>
+
+// template <class R>
+// class promise_batch
+// {
+//   template <class Ex>
+//   void commit(Ex& ex);
+// };
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/promise_batch.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+// main runs on the thread that initializes the globals
+const boost::thread::id committer = boost::this_thread::get_id();
+
+int twice(boost::future<int> f)
+{
+  BOOST_TEST(boost::this_thread::get_id() != committer);
+  return 2 * f.get();
+}
+
+void nothing(boost::future<void> f)
+{
+  f.get();
+}
+#endif
+
+int main()
+{
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+  {
+    // the continuations run on the executor
+    const int n = 100;
+    boost::basic_thread_pool ex(2);
+    boost::promise<int> p[n];
+    boost::future<int> f[n];
+    boost::promise_batch<int> b;
+    for (int i = 0; i < n; ++i)
+    {
+      f[i] = p[i].get_future().then(boost::launch::sync, &twice);
+      b.set_value(p[i], i);
+    }
+    b.commit(ex);
+    for (int i = 0; i < n; ++i)
+    {
+      BOOST_TEST_EQ(f[i].get(), 2 * i);
+    }
+  }
+  {
+    boost::basic_thread_pool ex(1);
+    boost::promise<void> p;
+    boost::future<void> f = p.get_future().then(boost::launch::sync, &nothing);
+    boost::promise_batch<void> b;
+    b.set_value(p);
+    b.commit(ex);
+    f.get();
+  }
+  {
+    // a closed executor lets the committing thread launch the continuations
+    boost::basic_thread_pool ex(1);
+    ex.close();
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future();
+    boost::future<int> g = f.then(boost::launch::async, &twice);
+    boost::promise_batch<int> b;
+    b.set_value(p, 1);
+    b.commit(ex);
+    BOOST_TEST_EQ(g.get(), 2);
+  }
+#endif
+
+  return boost::report_errors();
+}
@@ -0,0 +1,176 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/promise_batch.hpp>
+
+// template <class R>
+// class promise_batch
+// {
+//   void set_value(promise<R>& p, R const& v);
+//   void set_exception(promise<R>& p, exception_ptr e);
+//   void commit();
+// };
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/promise_batch.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+struct error
+{
+  int code;
+  explicit error(int c) : code(c) {}
+};
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+int twice(boost::future<int> f)
+{
+  return 2 * f.get();
+}
+#endif
+
+int main()
+{
+  {
+    boost::promise<int> p[10];
+    boost::future<int> f[10];
+    boost::promise_batch<int> b;
+    b.reserve(10);
+    for (int i = 0; i < 10; ++i)
+    {
+      f[i] = p[i].get_future();
+      b.set_value(p[i], i);
+    }
+    BOOST_TEST_EQ(b.size(), 10u);
+    BOOST_TEST(! f[0].is_ready());
+    b.commit();
+    BOOST_TEST(b.empty());
+    for (int i = 0; i < 10; ++i)
+    {
+      BOOST_TEST(f[i].is_ready());
+      BOOST_TEST_EQ(f[i].get(), i);
+    }
+  }
+  {
+    // the batch is reused once committed
+    boost::promise_batch<int> b;
+    for (int n = 0; n < 3; ++n)
+    {
+      boost::promise<int> p;
+      boost::future<int> f = p.get_future();
+      b.set_value(p, n);
+      b.commit();
+      BOOST_TEST_EQ(f.get(), n);
+    }
+  }
+  {
+    boost::promise<int> p1;
+    boost::promise<int> p2;
+    boost::future<int> f1 = p1.get_future();
+    boost::future<int> f2 = p2.get_future();
+    boost::promise_batch<int> b;
+    b.set_exception(p1, error(3));
+    b.set_value(p2, 4);
+    b.commit();
+    try
+    {
+      f1.get();
+      BOOST_TEST(false);
+    }
+    catch (error& e)
+    {
+      BOOST_TEST_EQ(e.code, 3);
+    }
+    BOOST_TEST_EQ(f2.get(), 4);
+  }
+  {
+    boost::promise<void> p1;
+    boost::promise<void> p2;
+    boost::future<void> f1 = p1.get_future();
+    boost::future<void> f2 = p2.get_future();
+    boost::promise_batch<void> b;
+    b.set_value(p1);
+    b.set_value(p2);
+    b.commit();
+    BOOST_TEST(f1.is_ready() && f1.has_value());
+    BOOST_TEST(f2.is_ready() && f2.has_value());
+  }
+  {
+    // a promise satisfied before the commit is reported once the others are ready
+    boost::promise<int> p1;
+    boost::promise<int> p2;
+    boost::future<int> f2 = p2.get_future();
+    boost::promise_batch<int> b;
+    b.set_value(p1, 1);
+    b.set_value(p2, 2);
+    p1.set_value(0);
+    try
+    {
+      b.commit();
+      BOOST_TEST(false);
+    }
+    catch (boost::promise_already_satisfied&)
+    {
+    }
+    BOOST_TEST_EQ(f2.get(), 2);
+    BOOST_TEST(b.empty());
+    try
+    {
+      b.set_value(p1, 1);
+      BOOST_TEST(false);
+    }
+    catch (boost::promise_already_satisfied&)
+    {
+    }
+  }
+  {
+    // the promise can be destroyed once added to the batch
+    boost::future<int> f;
+    boost::promise_batch<int> b;
+    {
+      boost::promise<int> p;
+      f = p.get_future();
+      b.set_value(p, 1);
+    }
+    BOOST_TEST(! f.is_ready());
+    b.commit();
+    BOOST_TEST_EQ(f.get(), 1);
+  }
+  {
+    // the batch destroyed without commit breaks its promises
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future();
+    {
+      boost::promise_batch<int> b;
+      b.set_value(p, 1);
+    }
+    try
+    {
+      f.get();
+      BOOST_TEST(false);
+    }
+    catch (boost::broken_promise&)
+    {
+    }
+  }
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+  {
+    // the continuations are launched once all the futures are ready
+    boost::promise<int> p1;
+    boost::promise<int> p2;
+    boost::future<int> f1 = p1.get_future().then(boost::launch::sync, &twice);
+    boost::future<int> f2 = p2.get_future().then(boost::launch::async, &twice);
+    boost::promise_batch<int> b;
+    b.set_value(p1, 1);
+    b.set_value(p2, 2);
+    b.commit();
+    BOOST_TEST(f1.is_ready());
+    BOOST_TEST_EQ(f1.get(), 2);
+    BOOST_TEST_EQ(f2.get(), 4);
+  }
+#endif
+
+  return boost::report_errors();
+}
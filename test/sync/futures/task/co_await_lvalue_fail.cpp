@@ -0,0 +1,29 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future_coroutine.hpp>
+
+// template <class T>
+// class task;
+
+// a task can't co_await a future lvalue.
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/future_coroutine.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+boost::task<int> get(boost::future<int>& f)
+{
+  co_return co_await f;
+}
+
+int main()
+{
+  return boost::report_errors();
+}
+
+#include "../../../remove_error_code_unused_warning.hpp"
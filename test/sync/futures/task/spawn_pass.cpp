@@ -0,0 +1,133 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future_coroutine.hpp>
+
+// template <class T>
+// class task;
+// template <class Ex, class T>
+// future<T> spawn(Ex& ex, task<T> t);
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+
+#include <boost/thread/future_coroutine.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/executors/executor_adaptor.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_COROUTINES
+
+int p1()
+{
+  boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+  return 1;
+}
+
+boost::task<int> one()
+{
+  co_return 1;
+}
+
+boost::task<int> slow_one()
+{
+  co_return co_await boost::async(boost::launch::async, &p1);
+}
+
+boost::task<int> sum(int n)
+{
+  int s = 0;
+  for (int i = 0; i < n; ++i)
+  {
+    s += co_await slow_one();
+  }
+  co_return s;
+}
+
+boost::task<void> check_thread(boost::thread::id not_on)
+{
+  co_await boost::async(boost::launch::async, &p1);
+  BOOST_TEST(boost::this_thread::get_id() != not_on);
+}
+
+boost::task<int> thr()
+{
+  co_await one();
+  throw std::logic_error("thr");
+}
+
+boost::task<int> catch_thr()
+{
+  try
+  {
+    co_return co_await thr();
+  }
+  catch (std::logic_error&)
+  {
+    co_return -1;
+  }
+}
+
+int main()
+{
+  {
+    boost::basic_thread_pool ex(2);
+    boost::future<int> f = boost::spawn(ex, one());
+    BOOST_TEST_EQ(f.get(), 1);
+  }
+  {
+    boost::basic_thread_pool ex(2);
+    boost::future<int> f = boost::spawn(ex, sum(3));
+    BOOST_TEST_EQ(f.get(), 3);
+  }
+  {
+    boost::basic_thread_pool ex(1);
+    boost::future<void> f = boost::spawn(ex, check_thread(boost::this_thread::get_id()));
+    f.get();
+  }
+  {
+    boost::basic_thread_pool ex(2);
+    boost::future<int> f = boost::spawn(ex, thr());
+    try
+    {
+      f.get();
+      BOOST_TEST(false);
+    }
+    catch (std::logic_error&)
+    {
+    }
+    BOOST_TEST_EQ(boost::spawn(ex, catch_thr()).get(), -1);
+  }
+  {
+    // many tasks waiting on few threads
+    boost::executor_adaptor<boost::basic_thread_pool> ex(2);
+    boost::csbl::vector<boost::future<int> > fs;
+    for (int i = 0; i < 200; ++i)
+    {
+      fs.push_back(boost::spawn(ex, slow_one()));
+    }
+    int s = 0;
+    for (std::size_t i = 0; i < fs.size(); ++i)
+    {
+      s += fs[i].get();
+    }
+    BOOST_TEST_EQ(s, 200);
+  }
+  {
+    // a task that is not spawned is destroyed without running
+    boost::task<int> t = one();
+    BOOST_TEST(t.valid());
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
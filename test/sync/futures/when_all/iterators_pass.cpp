@@ -0,0 +1,115 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// template <class InputIterator>
+// future<vector<typename InputIterator::value_type>>
+//     when_all(InputIterator first, InputIterator last);
+
+#define BOOST_THREAD_VERSION 4
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#include <boost/thread/future.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY
+
+int p1()
+{
+  boost::this_thread::sleep_for(boost::chrono::milliseconds(100));
+  return 123;
+}
+
+int thr()
+{
+  throw std::logic_error("thr");
+}
+
+int main()
+{
+  {
+    // empty range
+    boost::csbl::vector<boost::future<int> > v;
+    boost::future<boost::csbl::vector<boost::future<int> > > all = boost::when_all(v.begin(), v.end());
+    BOOST_TEST(all.is_ready());
+    BOOST_TEST(all.get().empty());
+  }
+  {
+    boost::csbl::vector<boost::future<int> > v;
+    v.push_back(boost::async(boost::launch::async, &p1));
+    v.push_back(boost::make_ready_future(321));
+    boost::future<boost::csbl::vector<boost::future<int> > > all = boost::when_all(v.begin(), v.end());
+    BOOST_TEST(all.valid());
+    boost::csbl::vector<boost::future<int> > res = all.get();
+    BOOST_TEST_EQ(res.size(), 2u);
+    BOOST_TEST(res[0].is_ready());
+    BOOST_TEST(res[1].is_ready());
+    BOOST_TEST_EQ(res[0].get(), 123);
+    BOOST_TEST_EQ(res[1].get(), 321);
+  }
+  {
+    // the promises are satisfied after when_all returns
+    const std::size_t n = 150;
+    boost::csbl::vector<boost::promise<int> > ps(n);
+    boost::csbl::vector<boost::future<int> > v;
+    for (std::size_t i = 0; i < n; ++i)
+      v.push_back(ps[i].get_future());
+    boost::future<boost::csbl::vector<boost::future<int> > > all = boost::when_all(v.begin(), v.end());
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      BOOST_TEST(! all.is_ready());
+      ps[i].set_value(int(i));
+    }
+    BOOST_TEST(all.is_ready());
+    boost::csbl::vector<boost::future<int> > res = all.get();
+    BOOST_TEST_EQ(res.size(), n);
+    for (std::size_t i = 0; i < n; ++i)
+      BOOST_TEST_EQ(res[i].get(), int(i));
+  }
+  {
+    // an exception doesn't make when_all fail, it is kept in the future
+    boost::csbl::vector<boost::future<int> > v;
+    v.push_back(boost::async(boost::launch::async, &thr));
+    v.push_back(boost::async(boost::launch::async, &p1));
+    boost::csbl::vector<boost::future<int> > res = boost::when_all(v.begin(), v.end()).get();
+    BOOST_TEST(res[0].has_exception());
+    BOOST_TEST_EQ(res[1].get(), 123);
+  }
+  {
+    // the deferred futures are run when the result is waited for
+    boost::csbl::vector<boost::future<int> > v;
+    v.push_back(boost::async(boost::launch::deferred, &p1));
+    v.push_back(boost::async(boost::launch::async, &p1));
+    boost::future<boost::csbl::vector<boost::future<int> > > all = boost::when_all(v.begin(), v.end());
+    boost::csbl::vector<boost::future<int> > res = all.get();
+    BOOST_TEST_EQ(res[0].get(), 123);
+    BOOST_TEST_EQ(res[1].get(), 123);
+  }
+  {
+    boost::promise<int> p;
+    boost::shared_future<int> sf = p.get_future().share();
+    boost::csbl::vector<boost::shared_future<int> > v1(1, sf);
+    boost::csbl::vector<boost::shared_future<int> > v2(2, sf);
+    boost::future<boost::csbl::vector<boost::shared_future<int> > > all1 = boost::when_all(v1.begin(), v1.end());
+    boost::future<boost::csbl::vector<boost::shared_future<int> > > all2 = boost::when_all(v2.begin(), v2.end());
+    p.set_value(3);
+    BOOST_TEST_EQ(all1.get()[0].get(), 3);
+    BOOST_TEST_EQ(all2.get()[1].get(), 3);
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
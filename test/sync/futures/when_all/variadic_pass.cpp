@@ -0,0 +1,95 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// template <typename F0, typename... F>
+// future<vector<F0>> when_all(F0&& f0, F&&... futures);  // all the futures of the same type
+// template <typename F0, typename... F>
+// future<tuple<F0, F...>> when_all(F0&& f0, F&&... futures);
+
+#define BOOST_THREAD_VERSION 4
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#include <boost/thread/future.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY
+
+int p1()
+{
+  boost::this_thread::sleep_for(boost::chrono::milliseconds(100));
+  return 123;
+}
+
+void p2()
+{
+  boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+}
+
+int main()
+{
+  {
+    boost::future<boost::csbl::tuple<> > all = boost::when_all();
+    BOOST_TEST(all.is_ready());
+  }
+  {
+    boost::future<int> f1 = boost::async(boost::launch::async, &p1);
+    boost::future<boost::csbl::vector<boost::future<int> > > all = boost::when_all(boost::move(f1));
+    BOOST_TEST(! f1.valid());
+    BOOST_TEST_EQ(all.get()[0].get(), 123);
+  }
+  {
+    boost::future<int> f1 = boost::async(boost::launch::async, &p1);
+    boost::future<int> f2 = boost::make_ready_future(321);
+    boost::future<int> f3 = boost::async(boost::launch::deferred, &p1);
+    boost::future<boost::csbl::vector<boost::future<int> > > all =
+        boost::when_all(boost::move(f1), boost::move(f2), boost::move(f3));
+    boost::csbl::vector<boost::future<int> > res = all.get();
+    BOOST_TEST_EQ(res.size(), 3u);
+    BOOST_TEST_EQ(res[0].get(), 123);
+    BOOST_TEST_EQ(res[1].get(), 321);
+    BOOST_TEST_EQ(res[2].get(), 123);
+  }
+  {
+    // futures of different types give a tuple
+    boost::promise<int> p;
+    boost::future<int> f1 = p.get_future();
+    boost::shared_future<void> f2 = boost::async(boost::launch::async, &p2).share();
+    boost::future<boost::csbl::tuple<boost::future<int>, boost::shared_future<void> > > all =
+        boost::when_all(boost::move(f1), f2);
+    BOOST_TEST(f2.valid());
+    BOOST_TEST(! all.is_ready());
+    p.set_value(1);
+    boost::csbl::tuple<boost::future<int>, boost::shared_future<void> > res = all.get();
+    BOOST_TEST_EQ(boost::csbl::get<0>(res).get(), 1);
+    BOOST_TEST(boost::csbl::get<1>(res).is_ready());
+  }
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+  {
+    boost::future<int> f1 = boost::async(boost::launch::async, &p1);
+    boost::future<int> f2 = boost::async(boost::launch::async, &p1);
+    boost::future<int> sum = boost::when_all(boost::move(f1), boost::move(f2)).then(
+        [](boost::future<boost::csbl::vector<boost::future<int> > > all) {
+          boost::csbl::vector<boost::future<int> > res = all.get();
+          return res[0].get() + res[1].get();
+        });
+    BOOST_TEST_EQ(sum.get(), 246);
+  }
+#endif
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
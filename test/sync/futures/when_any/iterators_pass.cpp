@@ -0,0 +1,89 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// template <class InputIterator>
+// future<vector<typename InputIterator::value_type>>
+//     when_any(InputIterator first, InputIterator last);
+
+#define BOOST_THREAD_VERSION 4
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#include <boost/thread/future.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY
+
+int p1()
+{
+  boost::this_thread::sleep_for(boost::chrono::milliseconds(100));
+  return 123;
+}
+
+int main()
+{
+  {
+    // empty range
+    boost::csbl::vector<boost::future<int> > v;
+    boost::future<boost::csbl::vector<boost::future<int> > > any = boost::when_any(v.begin(), v.end());
+    BOOST_TEST(any.is_ready());
+    BOOST_TEST(any.get().empty());
+  }
+  {
+    // ready as soon as one of the promises is satisfied
+    const std::size_t n = 150;
+    boost::csbl::vector<boost::promise<int> > ps(n);
+    boost::csbl::vector<boost::future<int> > v;
+    for (std::size_t i = 0; i < n; ++i)
+      v.push_back(ps[i].get_future());
+    boost::future<boost::csbl::vector<boost::future<int> > > any = boost::when_any(v.begin(), v.end());
+    BOOST_TEST(! any.is_ready());
+    ps[n / 2].set_value(1);
+    BOOST_TEST(any.is_ready());
+    ps[0].set_value(0);
+    boost::csbl::vector<boost::future<int> > res = any.get();
+    BOOST_TEST_EQ(res.size(), n);
+    BOOST_TEST(res[n / 2].is_ready());
+    BOOST_TEST(res[0].is_ready());
+    BOOST_TEST(! res[1].is_ready());
+    for (std::size_t i = 1; i < n; ++i)
+      if (i != n / 2)
+        ps[i].set_value(int(i));
+  }
+  {
+    boost::csbl::vector<boost::future<int> > v;
+    v.push_back(boost::async(boost::launch::async, &p1));
+    v.push_back(boost::make_ready_future(321));
+    boost::csbl::vector<boost::future<int> > res = boost::when_any(v.begin(), v.end()).get();
+    BOOST_TEST(res[1].is_ready());
+    BOOST_TEST_EQ(res[1].get(), 321);
+    BOOST_TEST_EQ(res[0].get(), 123);
+  }
+  {
+    // a deferred future is run when the result is waited for
+    boost::promise<int> p;
+    boost::csbl::vector<boost::future<int> > v;
+    v.push_back(p.get_future());
+    v.push_back(boost::async(boost::launch::deferred, &p1));
+    boost::csbl::vector<boost::future<int> > res = boost::when_any(v.begin(), v.end()).get();
+    BOOST_TEST(! res[0].is_ready());
+    BOOST_TEST(res[1].is_ready());
+    BOOST_TEST_EQ(res[1].get(), 123);
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
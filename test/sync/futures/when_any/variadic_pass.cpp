@@ -0,0 +1,79 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// template <typename F0, typename... F>
+// future<vector<F0>> when_any(F0&& f0, F&&... futures);  // all the futures of the same type
+// template <typename F0, typename... F>
+// future<tuple<F0, F...>> when_any(F0&& f0, F&&... futures);
+
+#define BOOST_THREAD_VERSION 4
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#include <boost/thread/future.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY
+
+int p1()
+{
+  boost::this_thread::sleep_for(boost::chrono::milliseconds(100));
+  return 123;
+}
+
+int main()
+{
+  {
+    boost::future<boost::csbl::tuple<> > any = boost::when_any();
+    BOOST_TEST(any.is_ready());
+  }
+  {
+    boost::future<int> f1 = boost::async(boost::launch::async, &p1);
+    boost::future<boost::csbl::vector<boost::future<int> > > any = boost::when_any(boost::move(f1));
+    BOOST_TEST(! f1.valid());
+    BOOST_TEST_EQ(any.get()[0].get(), 123);
+  }
+  {
+    boost::promise<int> p;
+    boost::future<int> f1 = p.get_future();
+    boost::future<int> f2 = boost::async(boost::launch::async, &p1);
+    boost::future<boost::csbl::vector<boost::future<int> > > any = boost::when_any(boost::move(f1), boost::move(f2));
+    boost::csbl::vector<boost::future<int> > res = any.get();
+    BOOST_TEST(! res[0].is_ready());
+    BOOST_TEST_EQ(res[1].get(), 123);
+    p.set_value(1);
+    BOOST_TEST_EQ(res[0].get(), 1);
+  }
+  {
+    // futures of different types give a tuple
+    boost::promise<int> p;
+    boost::promise<void> pv;
+    boost::future<int> f1 = p.get_future();
+    boost::shared_future<void> f2 = pv.get_future().share();
+    boost::future<boost::csbl::tuple<boost::future<int>, boost::shared_future<void> > > any =
+        boost::when_any(boost::move(f1), f2);
+    BOOST_TEST(! any.is_ready());
+    pv.set_value();
+    BOOST_TEST(any.is_ready());
+    boost::csbl::tuple<boost::future<int>, boost::shared_future<void> > res = any.get();
+    BOOST_TEST(! boost::csbl::get<0>(res).is_ready());
+    BOOST_TEST(boost::csbl::get<1>(res).is_ready());
+    p.set_value(1);
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
@@ -0,0 +1,297 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/lock_free_bounded_queue.hpp>
+
+// class lock_free_bounded_queue<T>
+
+//    push || pull;
+
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_QUEUE_DEPRECATE_OLD
+
+#include <boost/thread/lock_free_bounded_queue.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <boost/detail/lightweight_test.hpp>
+
+struct call_push_back
+{
+  boost::lock_free_bounded_queue<int> *q_;
+  boost::barrier *go_;
+
+  call_push_back(boost::lock_free_bounded_queue<int> *q, boost::barrier *go) :
+    q_(q), go_(go)
+  {
+  }
+  typedef void result_type;
+  void operator()()
+  {
+    go_->count_down_and_wait();
+    q_->push_back(42);
+  }
+};
+
+struct call_wait_pull_front
+{
+  boost::lock_free_bounded_queue<int> *q_;
+  boost::barrier *go_;
+
+  call_wait_pull_front(boost::lock_free_bounded_queue<int> *q, boost::barrier *go) :
+    q_(q), go_(go)
+  {
+  }
+  typedef int result_type;
+  int operator()()
+  {
+    go_->count_down_and_wait();
+    int i = 0;
+    if (q_->wait_pull_front(i) == boost::queue_op_status::closed) return -1;
+    return i;
+  }
+};
+
+struct producer
+{
+  boost::lock_free_bounded_queue<int> *q_;
+  int first_;
+  int n_;
+
+  producer(boost::lock_free_bounded_queue<int> *q, int first, int n) :
+    q_(q), first_(first), n_(n)
+  {
+  }
+  void operator()()
+  {
+    for (int i = first_; i < first_ + n_; ++i)
+      q_->push_back(i);
+  }
+};
+
+struct producer_until_closed
+{
+  boost::lock_free_bounded_queue<int> *q_;
+  int *count_;
+
+  producer_until_closed(boost::lock_free_bounded_queue<int> *q, int *count) :
+    q_(q), count_(count)
+  {
+  }
+  void operator()()
+  {
+    for (;;)
+    {
+      boost::queue_op_status st = q_->try_push_back(1);
+      if (st == boost::queue_op_status::closed) return;
+      if (st == boost::queue_op_status::success) ++*count_;
+      else boost::this_thread::yield();
+    }
+  }
+};
+
+struct consumer
+{
+  boost::lock_free_bounded_queue<int> *q_;
+  long *sum_;
+  int *count_;
+
+  consumer(boost::lock_free_bounded_queue<int> *q, long *sum, int *count) :
+    q_(q), sum_(sum), count_(count)
+  {
+  }
+  void operator()()
+  {
+    int i;
+    while (q_->wait_pull_front(i) == boost::queue_op_status::success)
+    {
+      *sum_ += i;
+      ++*count_;
+    }
+  }
+};
+
+void test_concurrent_push_and_wait_pull_front_on_empty_queue()
+{
+  boost::lock_free_bounded_queue<int> q(2);
+
+  boost::barrier go(2);
+
+  boost::future<int> pull_done;
+
+  try
+  {
+    pull_done=boost::async(boost::launch::async,
+        call_wait_pull_front(&q,&go)
+    );
+
+    go.wait();
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+    q.push_back(42);
+
+    BOOST_TEST_EQ(pull_done.get(), 42);
+    BOOST_TEST(q.empty());
+  }
+  catch (...)
+  {
+    BOOST_TEST(false);
+  }
+}
+
+void test_close_wakes_up_wait_pull_front_on_empty_queue()
+{
+  boost::lock_free_bounded_queue<int> q(2);
+
+  boost::barrier go(2);
+
+  boost::future<int> pull_done;
+
+  try
+  {
+    pull_done=boost::async(boost::launch::async,
+        call_wait_pull_front(&q,&go)
+    );
+
+    go.wait();
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+    q.close();
+
+    BOOST_TEST_EQ(pull_done.get(), -1);
+    BOOST_TEST(q.empty());
+  }
+  catch (...)
+  {
+    BOOST_TEST(false);
+  }
+}
+
+void test_push_back_on_full_queue_waits_for_pull()
+{
+  boost::lock_free_bounded_queue<int> q(2);
+
+  boost::barrier go(2);
+
+  boost::future<void> push_done;
+
+  try
+  {
+    q.push_back(1);
+    q.push_back(2);
+    push_done=boost::async(boost::launch::async,
+        call_push_back(&q,&go)
+    );
+
+    go.wait();
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+    BOOST_TEST(q.full());
+    BOOST_TEST_EQ(q.pull_front(), 1);
+    push_done.get();
+
+    BOOST_TEST_EQ(q.pull_front(), 2);
+    BOOST_TEST_EQ(q.pull_front(), 42);
+    BOOST_TEST(q.empty());
+  }
+  catch (...)
+  {
+    BOOST_TEST(false);
+  }
+}
+
+void test_concurrent_producers_and_consumers()
+{
+  boost::lock_free_bounded_queue<int> q(8);
+  const int n = 4;
+  const int items = 10000;
+  long sums[n] = {};
+  int counts[n] = {};
+
+  try
+  {
+    boost::thread_group consumers;
+    for (int i = 0; i < n; ++i)
+      consumers.create_thread(consumer(&q, &sums[i], &counts[i]));
+    boost::thread_group producers;
+    for (int i = 0; i < n; ++i)
+      producers.create_thread(producer(&q, i * items, items));
+
+    producers.join_all();
+    q.close();
+    consumers.join_all();
+
+    long sum = 0;
+    int count = 0;
+    for (int i = 0; i < n; ++i)
+    {
+      sum += sums[i];
+      count += counts[i];
+    }
+    const long total = long(n) * items;
+    BOOST_TEST_EQ(count, n * items);
+    BOOST_TEST_EQ(sum, total * (total - 1) / 2);
+    BOOST_TEST(q.empty());
+  }
+  catch (...)
+  {
+    BOOST_TEST(false);
+  }
+}
+
+void test_close_while_pushing_loses_no_element()
+{
+  const int n = 4;
+  for (int round = 0; round < 20; ++round)
+  {
+    boost::lock_free_bounded_queue<int> q(8);
+    long sums[n] = {};
+    int pulled[n] = {};
+    int pushed[n] = {};
+
+    try
+    {
+      boost::thread_group threads;
+      for (int i = 0; i < n; ++i)
+      {
+        threads.create_thread(consumer(&q, &sums[i], &pulled[i]));
+        threads.create_thread(producer_until_closed(&q, &pushed[i]));
+      }
+      boost::this_thread::sleep_for(boost::chrono::milliseconds(5));
+      q.close();
+      threads.join_all();
+
+      int push_count = 0;
+      int pull_count = 0;
+      for (int i = 0; i < n; ++i)
+      {
+        push_count += pushed[i];
+        pull_count += pulled[i];
+      }
+      // an element pushed concurrently with close() is either refused or pulled
+      BOOST_TEST_EQ(pull_count, push_count);
+      BOOST_TEST(q.empty());
+    }
+    catch (...)
+    {
+      BOOST_TEST(false);
+    }
+  }
+}
+
+int main()
+{
+  test_concurrent_push_and_wait_pull_front_on_empty_queue();
+  test_close_wakes_up_wait_pull_front_on_empty_queue();
+  test_push_back_on_full_queue_waits_for_pull();
+  test_concurrent_producers_and_consumers();
+  test_close_while_pushing_loses_no_element();
+
+  return boost::report_errors();
+}
+
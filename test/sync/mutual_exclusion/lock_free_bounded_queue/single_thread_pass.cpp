@@ -0,0 +1,245 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/lock_free_bounded_queue.hpp>
+
+// class lock_free_bounded_queue<T>
+
+//    lock_free_bounded_queue(size_type);
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_QUEUE_DEPRECATE_OLD
+
+#include <boost/thread/lock_free_bounded_queue.hpp>
+
+#include <boost/detail/lightweight_test.hpp>
+
+class non_copyable
+{
+  BOOST_THREAD_MOVABLE_ONLY(non_copyable)
+  int val;
+public:
+  non_copyable() {}
+  non_copyable(int v) : val(v){}
+  non_copyable(BOOST_RV_REF(non_copyable) x): val(x.val) {}
+  non_copyable& operator=(BOOST_RV_REF(non_copyable) x) { val=x.val; return *this; }
+  bool operator==(non_copyable const& x) const {return val==x.val;}
+  template <typename OSTREAM>
+  friend OSTREAM& operator <<(OSTREAM& os, non_copyable const&x )
+  {
+    os << x.val;
+    return os;
+  }
+
+};
+
+
+int main()
+{
+
+  {
+    // default queue invariants
+      boost::lock_free_bounded_queue<int> q(2);
+      BOOST_TEST(q.empty());
+      BOOST_TEST(! q.full());
+      BOOST_TEST_EQ(q.size(), 0u);
+      BOOST_TEST_EQ(q.capacity(), 2u);
+      BOOST_TEST(! q.closed());
+  }
+  {
+    // capacity is rounded up to a power of two
+      boost::lock_free_bounded_queue<int> q(3);
+      BOOST_TEST_EQ(q.capacity(), 4u);
+  }
+  {
+    // empty queue try_pull fails
+      boost::lock_free_bounded_queue<int> q(2);
+      int i;
+      BOOST_TEST( boost::queue_op_status::empty == q.try_pull_front(i));
+      BOOST_TEST( boost::queue_op_status::empty == q.nonblocking_pull_front(i));
+      BOOST_TEST(q.empty());
+      BOOST_TEST(! q.full());
+      BOOST_TEST_EQ(q.size(), 0u);
+      BOOST_TEST(! q.closed());
+  }
+  {
+    // empty queue push rvalue succeeds
+      boost::lock_free_bounded_queue<int> q(2);
+      q.push_back(1);
+      BOOST_TEST(! q.empty());
+      BOOST_TEST(! q.full());
+      BOOST_TEST_EQ(q.size(), 1u);
+      BOOST_TEST(! q.closed());
+  }
+  {
+    // empty queue push rvalue succeeds
+      boost::lock_free_bounded_queue<non_copyable> q(2);
+      non_copyable nc(1);
+      q.push_back(boost::move(nc));
+      BOOST_TEST(! q.empty());
+      BOOST_TEST(! q.full());
+      BOOST_TEST_EQ(q.size(), 1u);
+      BOOST_TEST(! q.closed());
+  }
+  {
+    // empty queue push value succeeds
+      boost::lock_free_bounded_queue<int> q(2);
+      int i = 1;
+      q.push_back(i);
+      BOOST_TEST(! q.empty());
+      BOOST_TEST_EQ(q.size(), 1u);
+  }
+  {
+    // empty queue try_push rvalue succeeds
+      boost::lock_free_bounded_queue<non_copyable> q(2);
+      non_copyable nc(1);
+      BOOST_TEST(boost::queue_op_status::success == q.try_push_back(boost::move(nc)));
+      BOOST_TEST(! q.empty());
+      BOOST_TEST_EQ(q.size(), 1u);
+  }
+  {
+    // empty queue nonblocking_push value succeeds
+      boost::lock_free_bounded_queue<int> q(2);
+      int i = 1;
+      BOOST_TEST(boost::queue_op_status::success == q.nonblocking_push_back(i));
+      BOOST_TEST(! q.empty());
+      BOOST_TEST_EQ(q.size(), 1u);
+  }
+  {
+    // full queue try_push fails
+      boost::lock_free_bounded_queue<int> q(2);
+      q.push_back(1);
+      q.push_back(2);
+      BOOST_TEST(boost::queue_op_status::full == q.try_push_back(3));
+      BOOST_TEST(boost::queue_op_status::full == q.nonblocking_push_back(3));
+      BOOST_TEST(! q.empty());
+      BOOST_TEST( q.full());
+      BOOST_TEST_EQ(q.size(), 2u);
+      BOOST_TEST(! q.closed());
+  }
+  {
+    // 1-element queue pull succeed
+      boost::lock_free_bounded_queue<int> q(2);
+      q.push_back(1);
+      int i;
+      q.pull_front(i);
+      BOOST_TEST_EQ(i, 1);
+      BOOST_TEST(q.empty());
+      BOOST_TEST(! q.full());
+      BOOST_TEST_EQ(q.size(), 0u);
+      BOOST_TEST(! q.closed());
+  }
+  {
+    // 1-element queue pull succeed
+      boost::lock_free_bounded_queue<non_copyable> q(2);
+      non_copyable nc(1);
+      q.push_back(boost::move(nc));
+      non_copyable nc2(2);
+      q.pull_front(nc2);
+      BOOST_TEST_EQ(nc, nc2);
+      BOOST_TEST(q.empty());
+  }
+  {
+    // 1-element queue pull_front value succeed
+      boost::lock_free_bounded_queue<int> q(2);
+      q.push_back(1);
+      int i = q.pull_front();
+      BOOST_TEST_EQ(i, 1);
+      BOOST_TEST(q.empty());
+  }
+  {
+    // 1-element queue wait_pull_front succeed
+      boost::lock_free_bounded_queue<int> q(2);
+      q.push_back(1);
+      int i;
+      BOOST_TEST(boost::queue_op_status::success == q.wait_pull_front(i));
+      BOOST_TEST_EQ(i, 1);
+      BOOST_TEST(q.empty());
+  }
+  {
+    // elements are pulled in order when the indexes wrap around the ring
+      boost::lock_free_bounded_queue<int> q(4);
+      int i;
+      for (int k = 0; k < 10; ++k)
+      {
+        BOOST_TEST(boost::queue_op_status::success == q.try_push_back(2*k));
+        BOOST_TEST(boost::queue_op_status::success == q.try_push_back(2*k+1));
+        BOOST_TEST(boost::queue_op_status::success == q.try_pull_front(i));
+        BOOST_TEST_EQ(i, 2*k);
+        BOOST_TEST(boost::queue_op_status::success == q.try_pull_front(i));
+        BOOST_TEST_EQ(i, 2*k+1);
+      }
+      BOOST_TEST(q.empty());
+  }
+  {
+    // full queue wait_push_back succeeds after a pull
+      boost::lock_free_bounded_queue<int> q(2);
+      q.push_back(1);
+      q.push_back(2);
+      int i;
+      q.pull_front(i);
+      BOOST_TEST(boost::queue_op_status::success == q.wait_push_back(3));
+      BOOST_TEST( q.full());
+  }
+  {
+    // closed invariants
+      boost::lock_free_bounded_queue<int> q(2);
+      q.close();
+      BOOST_TEST(q.empty());
+      BOOST_TEST(! q.full());
+      BOOST_TEST_EQ(q.size(), 0u);
+      BOOST_TEST(q.closed());
+  }
+  {
+    // closed queue push fails
+      boost::lock_free_bounded_queue<int> q(2);
+      q.close();
+      try {
+        q.push_back(1);
+        BOOST_TEST(false);
+      } catch (...) {
+        BOOST_TEST(q.empty());
+        BOOST_TEST(! q.full());
+        BOOST_TEST_EQ(q.size(), 0u);
+        BOOST_TEST(q.closed());
+      }
+  }
+  {
+    // closed queue try_push fails
+      boost::lock_free_bounded_queue<int> q(2);
+      q.close();
+      BOOST_TEST(boost::queue_op_status::closed == q.try_push_back(1));
+      BOOST_TEST(boost::queue_op_status::closed == q.wait_push_back(1));
+      BOOST_TEST(q.empty());
+  }
+  {
+    // 1-element closed queue pull succeed
+      boost::lock_free_bounded_queue<int> q(2);
+      q.push_back(1);
+      q.close();
+      int i;
+      q.pull_front(i);
+      BOOST_TEST_EQ(i, 1);
+      BOOST_TEST(q.empty());
+      BOOST_TEST(q.closed());
+  }
+  {
+    // empty closed queue pull fails
+      boost::lock_free_bounded_queue<int> q(2);
+      q.close();
+      int i;
+      BOOST_TEST(boost::queue_op_status::closed == q.try_pull_front(i));
+      BOOST_TEST(boost::queue_op_status::closed == q.wait_pull_front(i));
+      try {
+        q.pull_front(i);
+        BOOST_TEST(false);
+      } catch (boost::sync_queue_is_closed&) {
+        BOOST_TEST(q.closed());
+      }
+  }
+
+  return boost::report_errors();
+}
+
@@ -0,0 +1,302 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/spsc_queue.hpp>
+
+// class spsc_queue<T>
+
+//    push || pull;
+
+#include <boost/config.hpp>
+#if ! defined  BOOST_NO_CXX11_DECLTYPE
+#define BOOST_RESULT_OF_USE_DECLTYPE
+#endif
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_QUEUE_DEPRECATE_OLD
+
+#include <boost/thread/spsc_queue.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <boost/detail/lightweight_test.hpp>
+
+struct call_push_back
+{
+  boost::spsc_queue<int> *q_;
+  boost::barrier *go_;
+
+  call_push_back(boost::spsc_queue<int> *q, boost::barrier *go) :
+    q_(q), go_(go)
+  {
+  }
+  typedef void result_type;
+  void operator()()
+  {
+    go_->count_down_and_wait();
+    q_->push_back(42);
+  }
+};
+
+struct call_wait_pull_front
+{
+  boost::spsc_queue<int> *q_;
+  boost::barrier *go_;
+
+  call_wait_pull_front(boost::spsc_queue<int> *q, boost::barrier *go) :
+    q_(q), go_(go)
+  {
+  }
+  typedef int result_type;
+  int operator()()
+  {
+    go_->count_down_and_wait();
+    int i = 0;
+    if (q_->wait_pull_front(i) == boost::queue_op_status::closed) return -1;
+    return i;
+  }
+};
+
+struct producer
+{
+  boost::spsc_queue<int> *q_;
+  int n_;
+  bool batch_;
+
+  producer(boost::spsc_queue<int> *q, int n, bool batch) :
+    q_(q), n_(n), batch_(batch)
+  {
+  }
+  void operator()()
+  {
+    if (batch_)
+    {
+      int v[10];
+      for (int i = 0; i < n_; i += 10)
+      {
+        for (int j = 0; j < 10; ++j) v[j] = i + j;
+        q_->push_back(v, v + 10);
+      }
+    }
+    else
+    {
+      for (int i = 0; i < n_; ++i)
+        q_->push_back(i);
+    }
+    q_->close();
+  }
+};
+
+struct producer_until_closed
+{
+  boost::spsc_queue<int> *q_;
+  int *pushed_;
+  bool batch_;
+
+  producer_until_closed(boost::spsc_queue<int> *q, int *pushed, bool batch) :
+    q_(q), pushed_(pushed), batch_(batch)
+  {
+  }
+  void operator()()
+  {
+    for (;;)
+    {
+      if (batch_)
+      {
+        int v[3] = { *pushed_, *pushed_ + 1, *pushed_ + 2 };
+        int* first = v;
+        boost::queue_op_status st = q_->try_push_back(first, v + 3);
+        *pushed_ += static_cast<int>(first - v);
+        if (st == boost::queue_op_status::closed) return;
+      }
+      else
+      {
+        if (q_->wait_push_back(*pushed_) == boost::queue_op_status::closed) return;
+        ++*pushed_;
+      }
+    }
+  }
+};
+
+struct consumer
+{
+  boost::spsc_queue<int> *q_;
+  bool *in_order_;
+  int *count_;
+  bool batch_;
+
+  consumer(boost::spsc_queue<int> *q, bool *in_order, int *count, bool batch) :
+    q_(q), in_order_(in_order), count_(count), batch_(batch)
+  {
+  }
+  void operator()()
+  {
+    int v[7];
+    std::size_t n = 1;
+    while ((batch_ ? q_->wait_pull_front_n(v, 7, n) : q_->wait_pull_front(v[0])) == boost::queue_op_status::success)
+    {
+      for (std::size_t j = 0; j < n; ++j)
+      {
+        if (v[j] != *count_) *in_order_ = false;
+        ++*count_;
+      }
+    }
+  }
+};
+
+void test_concurrent_push_and_wait_pull_front_on_empty_queue()
+{
+  boost::spsc_queue<int> q(2);
+
+  boost::barrier go(2);
+
+  boost::future<int> pull_done;
+
+  try
+  {
+    pull_done=boost::async(boost::launch::async,
+        call_wait_pull_front(&q,&go)
+    );
+
+    go.wait();
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+    q.push_back(42);
+
+    BOOST_TEST_EQ(pull_done.get(), 42);
+    BOOST_TEST(q.empty());
+  }
+  catch (...)
+  {
+    BOOST_TEST(false);
+  }
+}
+
+void test_close_wakes_up_wait_pull_front_on_empty_queue()
+{
+  boost::spsc_queue<int> q(2);
+
+  boost::barrier go(2);
+
+  boost::future<int> pull_done;
+
+  try
+  {
+    pull_done=boost::async(boost::launch::async,
+        call_wait_pull_front(&q,&go)
+    );
+
+    go.wait();
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+    q.close();
+
+    BOOST_TEST_EQ(pull_done.get(), -1);
+    BOOST_TEST(q.empty());
+  }
+  catch (...)
+  {
+    BOOST_TEST(false);
+  }
+}
+
+void test_push_back_on_full_queue_waits_for_pull()
+{
+  boost::spsc_queue<int> q(2);
+
+  boost::barrier go(2);
+
+  boost::future<void> push_done;
+
+  try
+  {
+    q.push_back(1);
+    q.push_back(2);
+    push_done=boost::async(boost::launch::async,
+        call_push_back(&q,&go)
+    );
+
+    go.wait();
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+    BOOST_TEST(q.full());
+    BOOST_TEST_EQ(q.pull_front(), 1);
+    push_done.get();
+
+    BOOST_TEST_EQ(q.pull_front(), 2);
+    BOOST_TEST_EQ(q.pull_front(), 42);
+    BOOST_TEST(q.empty());
+  }
+  catch (...)
+  {
+    BOOST_TEST(false);
+  }
+}
+
+void test_producer_and_consumer(bool batch)
+{
+  boost::spsc_queue<int> q(16);
+  const int items = 100000;
+  bool in_order = true;
+  int count = 0;
+
+  try
+  {
+    boost::thread c = boost::thread(consumer(&q, &in_order, &count, batch));
+    boost::thread p = boost::thread(producer(&q, items, batch));
+    p.join();
+    c.join();
+
+    BOOST_TEST_EQ(count, items);
+    BOOST_TEST(in_order);
+    BOOST_TEST(q.empty());
+  }
+  catch (...)
+  {
+    BOOST_TEST(false);
+  }
+}
+
+void test_close_while_pushing_loses_no_element(bool batch)
+{
+  for (int round = 0; round < 20; ++round)
+  {
+    boost::spsc_queue<int> q(8);
+    bool in_order = true;
+    int pulled = 0;
+    int pushed = 0;
+
+    try
+    {
+      boost::thread c = boost::thread(consumer(&q, &in_order, &pulled, batch));
+      boost::thread p = boost::thread(producer_until_closed(&q, &pushed, batch));
+      boost::this_thread::sleep_for(boost::chrono::milliseconds(5));
+      q.close();
+      p.join();
+      c.join();
+
+      // an element pushed concurrently with close() is either refused or pulled
+      BOOST_TEST_EQ(pulled, pushed);
+      BOOST_TEST(in_order);
+      BOOST_TEST(q.empty());
+    }
+    catch (...)
+    {
+      BOOST_TEST(false);
+    }
+  }
+}
+
+int main()
+{
+  test_concurrent_push_and_wait_pull_front_on_empty_queue();
+  test_close_wakes_up_wait_pull_front_on_empty_queue();
+  test_push_back_on_full_queue_waits_for_pull();
+  test_producer_and_consumer(false);
+  test_producer_and_consumer(true);
+  test_close_while_pushing_loses_no_element(false);
+  test_close_while_pushing_loses_no_element(true);
+
+  return boost::report_errors();
+}
+
@@ -0,0 +1,223 @@
+// Copyright (C) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/spsc_queue.hpp>
+
+// class spsc_queue<T>
+
+//    spsc_queue(size_type);
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_QUEUE_DEPRECATE_OLD
+
+#include <boost/thread/spsc_queue.hpp>
+
+#include <boost/detail/lightweight_test.hpp>
+
+class non_copyable
+{
+  BOOST_THREAD_MOVABLE_ONLY(non_copyable)
+  int val;
+public:
+  non_copyable() {}
+  non_copyable(int v) : val(v){}
+  non_copyable(BOOST_RV_REF(non_copyable) x): val(x.val) {}
+  non_copyable& operator=(BOOST_RV_REF(non_copyable) x) { val=x.val; return *this; }
+  bool operator==(non_copyable const& x) const {return val==x.val;}
+  template <typename OSTREAM>
+  friend OSTREAM& operator <<(OSTREAM& os, non_copyable const&x )
+  {
+    os << x.val;
+    return os;
+  }
+
+};
+
+
+int main()
+{
+
+  {
+    // default queue invariants
+      boost::spsc_queue<int> q(2);
+      BOOST_TEST(q.empty());
+      BOOST_TEST(! q.full());
+      BOOST_TEST_EQ(q.size(), 0u);
+      BOOST_TEST_EQ(q.capacity(), 2u);
+      BOOST_TEST(! q.closed());
+  }
+  {
+    // capacity is rounded up to a power of two
+      boost::spsc_queue<int> q(5);
+      BOOST_TEST_EQ(q.capacity(), 8u);
+  }
+  {
+    // empty queue try_pull fails
+      boost::spsc_queue<int> q(2);
+      int i;
+      BOOST_TEST( boost::queue_op_status::empty == q.try_pull_front(i));
+      BOOST_TEST( boost::queue_op_status::empty == q.nonblocking_pull_front(i));
+      BOOST_TEST(q.empty());
+      BOOST_TEST(! q.closed());
+  }
+  {
+    // empty queue push rvalue succeeds
+      boost::spsc_queue<int> q(2);
+      q.push_back(1);
+      BOOST_TEST(! q.empty());
+      BOOST_TEST(! q.full());
+      BOOST_TEST_EQ(q.size(), 1u);
+      BOOST_TEST(! q.closed());
+  }
+  {
+    // empty queue push rvalue succeeds
+      boost::spsc_queue<non_copyable> q(2);
+      non_copyable nc(1);
+      q.push_back(boost::move(nc));
+      BOOST_TEST(! q.empty());
+      BOOST_TEST_EQ(q.size(), 1u);
+  }
+  {
+    // empty queue try_push value succeeds
+      boost::spsc_queue<int> q(2);
+      int i = 1;
+      BOOST_TEST(boost::queue_op_status::success == q.try_push_back(i));
+      BOOST_TEST(boost::queue_op_status::success == q.nonblocking_push_back(2));
+      BOOST_TEST( q.full());
+      BOOST_TEST_EQ(q.size(), 2u);
+  }
+  {
+    // full queue try_push fails
+      boost::spsc_queue<int> q(2);
+      q.push_back(1);
+      q.push_back(2);
+      BOOST_TEST(boost::queue_op_status::full == q.try_push_back(3));
+      BOOST_TEST(boost::queue_op_status::full == q.nonblocking_push_back(3));
+      BOOST_TEST( q.full());
+      BOOST_TEST_EQ(q.size(), 2u);
+  }
+  {
+    // 1-element queue pull succeed
+      boost::spsc_queue<non_copyable> q(2);
+      non_copyable nc(1);
+      q.push_back(boost::move(nc));
+      non_copyable nc2(2);
+      q.pull_front(nc2);
+      BOOST_TEST_EQ(nc, nc2);
+      BOOST_TEST(q.empty());
+  }
+  {
+    // 1-element queue wait_pull_front succeed
+      boost::spsc_queue<int> q(2);
+      q.push_back(1);
+      int i;
+      BOOST_TEST(boost::queue_op_status::success == q.wait_pull_front(i));
+      BOOST_TEST_EQ(i, 1);
+      BOOST_TEST(q.empty());
+  }
+  {
+    // elements are pulled in order when the indexes wrap around the ring
+      boost::spsc_queue<int> q(4);
+      int i;
+      for (int k = 0; k < 10; ++k)
+      {
+        BOOST_TEST(boost::queue_op_status::success == q.try_push_back(2*k));
+        BOOST_TEST(boost::queue_op_status::success == q.try_push_back(2*k+1));
+        BOOST_TEST(boost::queue_op_status::success == q.try_pull_front(i));
+        BOOST_TEST_EQ(i, 2*k);
+        BOOST_TEST(boost::queue_op_status::success == q.try_pull_front(i));
+        BOOST_TEST_EQ(i, 2*k+1);
+      }
+      BOOST_TEST(q.empty());
+  }
+  {
+    // range try_push_back pushes as many elements as possible
+      boost::spsc_queue<int> q(4);
+      int v[] = {1, 2, 3, 4, 5, 6};
+      int* first = v;
+      BOOST_TEST(boost::queue_op_status::full == q.try_push_back(first, v + 6));
+      BOOST_TEST(first == v + 4);
+      BOOST_TEST( q.full());
+      int r[6] = {};
+      std::size_t n;
+      BOOST_TEST(boost::queue_op_status::success == q.try_pull_front_n(r, 3, n));
+      BOOST_TEST_EQ(n, 3u);
+      BOOST_TEST_EQ(r[0], 1);
+      BOOST_TEST_EQ(r[2], 3);
+      BOOST_TEST(boost::queue_op_status::success == q.try_push_back(first, v + 6));
+      BOOST_TEST(first == v + 6);
+      BOOST_TEST_EQ(q.pull_front(r, 6), 3u);
+      BOOST_TEST_EQ(r[0], 4);
+      BOOST_TEST_EQ(r[1], 5);
+      BOOST_TEST_EQ(r[2], 6);
+      BOOST_TEST(boost::queue_op_status::empty == q.try_pull_front_n(r, 6, n));
+      BOOST_TEST_EQ(n, 0u);
+  }
+  {
+    // range push_back on an empty queue succeeds
+      boost::spsc_queue<int> q(4);
+      int v[] = {1, 2, 3};
+      q.push_back(v, v + 3);
+      BOOST_TEST_EQ(q.size(), 3u);
+      int r[3] = {};
+      std::size_t n;
+      BOOST_TEST(boost::queue_op_status::success == q.wait_pull_front_n(r, 3, n));
+      BOOST_TEST_EQ(n, 3u);
+      BOOST_TEST_EQ(r[2], 3);
+  }
+  {
+    // closed invariants
+      boost::spsc_queue<int> q(2);
+      q.close();
+      BOOST_TEST(q.empty());
+      BOOST_TEST(! q.full());
+      BOOST_TEST_EQ(q.size(), 0u);
+      BOOST_TEST(q.closed());
+  }
+  {
+    // closed queue push fails
+      boost::spsc_queue<int> q(2);
+      q.close();
+      try {
+        q.push_back(1);
+        BOOST_TEST(false);
+      } catch (boost::sync_queue_is_closed&) {
+        BOOST_TEST(q.empty());
+        BOOST_TEST(q.closed());
+      }
+      BOOST_TEST(boost::queue_op_status::closed == q.try_push_back(1));
+      BOOST_TEST(boost::queue_op_status::closed == q.wait_push_back(1));
+  }
+  {
+    // 1-element closed queue pull succeed
+      boost::spsc_queue<int> q(2);
+      q.push_back(1);
+      q.close();
+      int i;
+      q.pull_front(i);
+      BOOST_TEST_EQ(i, 1);
+      BOOST_TEST(q.empty());
+      BOOST_TEST(q.closed());
+  }
+  {
+    // empty closed queue pull fails
+      boost::spsc_queue<int> q(2);
+      q.close();
+      int i;
+      BOOST_TEST(boost::queue_op_status::closed == q.try_pull_front(i));
+      BOOST_TEST(boost::queue_op_status::closed == q.wait_pull_front(i));
+      std::size_t n;
+      BOOST_TEST(boost::queue_op_status::closed == q.wait_pull_front_n(&i, 1, n));
+      try {
+        q.pull_front(i);
+        BOOST_TEST(false);
+      } catch (boost::sync_queue_is_closed&) {
+        BOOST_TEST(q.closed());
+      }
+  }
+
+  return boost::report_errors();
+}
+
@@ -77,6 +77,42 @@ struct call_pull
   }
 };
 
+struct call_wait_pull_front
+{
+  boost::sync_bounded_queue<int> *q_;
+  boost::barrier *go_;
+
+  call_wait_pull_front(boost::sync_bounded_queue<int> *q, boost::barrier *go) :
+    q_(q), go_(go)
+  {
+  }
+  typedef int result_type;
+  int operator()()
+  {
+    go_->count_down_and_wait();
+    int i = 0;
+    if (q_->wait_pull_front(i) == boost::queue_op_status::closed) return -1;
+    return i;
+  }
+};
+
+struct call_wait_push_back
+{
+  boost::sync_bounded_queue<int> *q_;
+  boost::barrier *go_;
+
+  call_wait_push_back(boost::sync_bounded_queue<int> *q, boost::barrier *go) :
+    q_(q), go_(go)
+  {
+  }
+  typedef int result_type;
+  int operator()()
+  {
+    go_->count_down_and_wait();
+    return q_->wait_push_back(42) == boost::queue_op_status::success ? 1 : 0;
+  }
+};
+
 void test_concurrent_push_and_pull_on_empty_queue()
 {
   boost::sync_bounded_queue<int> q(4);
@@ -240,12 +276,133 @@ void test_concurrent_pull_on_queue()
   }
 }
 
+void test_concurrent_push_and_wait_pull_front_on_empty_queue()
+{
+  boost::sync_bounded_queue<int> q(2);
+
+  boost::barrier go(2);
+
+  boost::future<int> pull_done;
+
+  try
+  {
+    pull_done=boost::async(boost::launch::async,
+        call_wait_pull_front(&q,&go)
+    );
+
+    go.wait();
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+    q.push_back(42);
+
+    BOOST_TEST_EQ(pull_done.get(), 42);
+    BOOST_TEST(q.empty());
+  }
+  catch (...)
+  {
+    BOOST_TEST(false);
+  }
+}
+
+void test_close_wakes_up_wait_pull_front_on_empty_queue()
+{
+  boost::sync_bounded_queue<int> q(2);
+
+  boost::barrier go(2);
+
+  boost::future<int> pull_done;
+
+  try
+  {
+    pull_done=boost::async(boost::launch::async,
+        call_wait_pull_front(&q,&go)
+    );
+
+    go.wait();
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+    q.close();
+
+    BOOST_TEST_EQ(pull_done.get(), -1);
+    BOOST_TEST(q.empty());
+  }
+  catch (...)
+  {
+    BOOST_TEST(false);
+  }
+}
+
+void test_range_push_wakes_up_several_wait_pull_front_on_empty_queue()
+{
+  boost::sync_bounded_queue<int> q(4);
+  const unsigned int n = 3;
+  boost::barrier go(n+1);
+
+  boost::future<int> pull_done[n];
+
+  try
+  {
+    for (unsigned int i =0; i< n; ++i)
+      pull_done[i]=boost::async(boost::launch::async,
+        call_wait_pull_front(&q,&go)
+    );
+
+    go.wait();
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+    int v[n] = {1, 2, 3};
+    q.push_back(v, v+n);
+
+    int sum = 0;
+    for (unsigned int i = 0; i < n; ++i)
+      sum += pull_done[i].get();
+    BOOST_TEST_EQ(sum, 6);
+    BOOST_TEST(q.empty());
+  }
+  catch (...)
+  {
+    BOOST_TEST(false);
+  }
+}
+
+void test_wait_push_back_on_full_queue_waits_for_pull_front_n()
+{
+  boost::sync_bounded_queue<int> q(2);
+
+  boost::barrier go(2);
+
+  boost::future<int> push_done;
+
+  try
+  {
+    q.push_back(1);
+    q.push_back(2);
+    push_done=boost::async(boost::launch::async,
+        call_wait_push_back(&q,&go)
+    );
+
+    go.wait();
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(50));
+    BOOST_TEST(q.full());
+    int r[2];
+    BOOST_TEST_EQ(q.pull_front(r, 2), 2u);
+    BOOST_TEST_EQ(push_done.get(), 1);
+    BOOST_TEST_EQ(q.pull_front(), 42);
+    BOOST_TEST(q.empty());
+  }
+  catch (...)
+  {
+    BOOST_TEST(false);
+  }
+}
+
 int main()
 {
   test_concurrent_push_and_pull_on_empty_queue();
   test_concurrent_push_on_empty_queue();
   test_concurrent_push_on_full_queue();
   test_concurrent_pull_on_queue();
+  test_concurrent_push_and_wait_pull_front_on_empty_queue();
+  test_close_wakes_up_wait_pull_front_on_empty_queue();
+  test_range_push_wakes_up_several_wait_pull_front_on_empty_queue();
+  test_wait_push_back_on_full_queue_waits_for_pull_front_n();
 
   return boost::report_errors();
 }
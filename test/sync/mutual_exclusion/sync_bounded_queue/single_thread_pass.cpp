@@ -491,6 +491,102 @@ int main()
       BOOST_TEST_EQ(q.size(), 0u);
       BOOST_TEST(q.closed());
   }
+  {
+    // 1-element queue wait_pull_front succeed
+      boost::sync_bounded_queue<int> q(2);
+      q.push_back(1);
+      int i;
+      BOOST_TEST(boost::queue_op_status::success == q.wait_pull_front(i));
+      BOOST_TEST_EQ(i, 1);
+      BOOST_TEST(q.empty());
+      BOOST_TEST(! q.full());
+      BOOST_TEST_EQ(q.size(), 0u);
+      BOOST_TEST(! q.closed());
+  }
+  {
+    // closed empty queue wait_pull_front doesn't block
+      boost::sync_bounded_queue<int> q(2);
+      q.close();
+      int i;
+      BOOST_TEST(boost::queue_op_status::closed == q.wait_pull_front(i));
+      BOOST_TEST(q.empty());
+      BOOST_TEST(q.closed());
+  }
+  {
+    // 1-element closed queue wait_pull_front succeed
+      boost::sync_bounded_queue<int> q(2);
+      q.push_back(1);
+      q.close();
+      int i;
+      BOOST_TEST(boost::queue_op_status::success == q.wait_pull_front(i));
+      BOOST_TEST_EQ(i, 1);
+      BOOST_TEST(q.empty());
+      BOOST_TEST(q.closed());
+  }
+
+  {
+    // range push_back succeeds
+      boost::sync_bounded_queue<int> q(4);
+      int v[] = {1, 2, 3};
+      q.push_back(v, v + 3);
+      BOOST_TEST(! q.empty());
+      BOOST_TEST_EQ(q.size(), 3u);
+  }
+  {
+    // range try_push_back pushes the elements that fit
+      boost::sync_bounded_queue<int> q(4);
+      int v[] = {1, 2, 3, 4, 5, 6};
+      int* first = v;
+      BOOST_TEST(boost::queue_op_status::full == q.try_push_back(first, v + 6));
+      BOOST_TEST(first == v + 4);
+      BOOST_TEST(q.full());
+      BOOST_TEST(boost::queue_op_status::full == q.try_push_back(first, v + 6));
+      BOOST_TEST(first == v + 4);
+  }
+  {
+    // pull_front of several elements succeeds
+      boost::sync_bounded_queue<int> q(4);
+      int v[] = {1, 2, 3, 4};
+      q.push_back(v, v + 4);
+      int r[4] = {};
+      BOOST_TEST_EQ(q.pull_front(r, 3), 3u);
+      BOOST_TEST_EQ(r[0], 1);
+      BOOST_TEST_EQ(r[2], 3);
+      int* first = v;
+      BOOST_TEST(boost::queue_op_status::success == q.try_push_back(first, v + 3));
+      std::size_t n;
+      BOOST_TEST(boost::queue_op_status::success == q.try_pull_front_n(r, 4, n));
+      BOOST_TEST_EQ(n, 4u);
+      BOOST_TEST_EQ(r[0], 4);
+      BOOST_TEST_EQ(r[1], 1);
+      BOOST_TEST_EQ(r[3], 3);
+      BOOST_TEST(boost::queue_op_status::empty == q.try_pull_front_n(r, 4, n));
+      BOOST_TEST_EQ(n, 0u);
+  }
+  {
+    // closed queue range push fails and wait_pull_front_n drains it
+      boost::sync_bounded_queue<int> q(4);
+      int v[] = {1, 2, 3};
+      q.push_back(v, v + 2);
+      q.close();
+      int* first = v;
+      BOOST_TEST(boost::queue_op_status::closed == q.try_push_back(first, v + 3));
+      BOOST_TEST(boost::queue_op_status::closed == q.wait_push_back(1));
+      int r[4] = {};
+      std::size_t n;
+      BOOST_TEST(boost::queue_op_status::success == q.wait_pull_front_n(r, 4, n));
+      BOOST_TEST_EQ(n, 2u);
+      BOOST_TEST(boost::queue_op_status::closed == q.wait_pull_front_n(r, 4, n));
+      BOOST_TEST_EQ(n, 0u);
+  }
+  {
+    // not full queue wait_push_back succeeds
+      boost::sync_bounded_queue<int> q(2);
+      int i = 1;
+      BOOST_TEST(boost::queue_op_status::success == q.wait_push_back(i));
+      BOOST_TEST(boost::queue_op_status::success == q.wait_push_back(2));
+      BOOST_TEST(q.full());
+  }
+
   return boost::report_errors();
 }
-
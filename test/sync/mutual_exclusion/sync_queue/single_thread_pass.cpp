@@ -650,7 +650,90 @@ int main()
       BOOST_TEST_EQ(q.size(), 0u);
       BOOST_TEST(q.closed());
   }
+  {
+    // 1-element queue wait_pull_front succeed
+      boost::sync_queue<int> q;
+      q.push_back(1);
+      int i;
+      BOOST_TEST(boost::queue_op_status::success == q.wait_pull_front(i));
+      BOOST_TEST_EQ(i, 1);
+      BOOST_TEST(q.empty());
+      BOOST_TEST(! q.full());
+      BOOST_TEST_EQ(q.size(), 0u);
+      BOOST_TEST(! q.closed());
+  }
+  {
+    // closed empty queue wait_pull_front doesn't block
+      boost::sync_queue<int> q;
+      q.close();
+      int i;
+      BOOST_TEST(boost::queue_op_status::closed == q.wait_pull_front(i));
+      BOOST_TEST(q.empty());
+      BOOST_TEST(q.closed());
+  }
+  {
+    // 1-element closed queue wait_pull_front succeed
+      boost::sync_queue<int> q;
+      q.push_back(1);
+      q.close();
+      int i;
+      BOOST_TEST(boost::queue_op_status::success == q.wait_pull_front(i));
+      BOOST_TEST_EQ(i, 1);
+      BOOST_TEST(q.empty());
+      BOOST_TEST(q.closed());
+  }
+
+  {
+    // range push_back succeeds
+      boost::sync_queue<int> q;
+      int v[] = {1, 2, 3};
+      q.push_back(v, v + 3);
+      BOOST_TEST(! q.empty());
+      BOOST_TEST_EQ(q.size(), 3u);
+      int* first = v;
+      BOOST_TEST(boost::queue_op_status::success == q.try_push_back(first, v + 3));
+      BOOST_TEST(first == v + 3);
+      BOOST_TEST_EQ(q.size(), 6u);
+  }
+  {
+    // pull_front of several elements succeeds
+      boost::sync_queue<int> q;
+      int v[] = {1, 2, 3};
+      q.push_back(v, v + 3);
+      int r[4] = {};
+      BOOST_TEST_EQ(q.pull_front(r, 2), 2u);
+      BOOST_TEST_EQ(r[0], 1);
+      BOOST_TEST_EQ(r[1], 2);
+      std::size_t n;
+      BOOST_TEST(boost::queue_op_status::success == q.try_pull_front_n(r, 4, n));
+      BOOST_TEST_EQ(n, 1u);
+      BOOST_TEST_EQ(r[0], 3);
+      BOOST_TEST(boost::queue_op_status::empty == q.try_pull_front_n(r, 4, n));
+      BOOST_TEST_EQ(n, 0u);
+      BOOST_TEST(q.empty());
+  }
+  {
+    // closed queue range push fails and wait_pull_front_n drains it
+      boost::sync_queue<int> q;
+      int v[] = {1, 2, 3};
+      q.push_back(v, v + 2);
+      q.close();
+      int* first = v;
+      BOOST_TEST(boost::queue_op_status::closed == q.try_push_back(first, v + 3));
+      BOOST_TEST(first == v);
+      try {
+        q.push_back(v, v + 3);
+        BOOST_TEST(false);
+      } catch (boost::sync_queue_is_closed&) {
+        BOOST_TEST_EQ(q.size(), 2u);
+      }
+      int r[4] = {};
+      std::size_t n;
+      BOOST_TEST(boost::queue_op_status::success == q.wait_pull_front_n(r, 4, n));
+      BOOST_TEST_EQ(n, 2u);
+      BOOST_TEST(boost::queue_op_status::closed == q.wait_pull_front_n(r, 4, n));
+      BOOST_TEST_EQ(n, 0u);
+  }
 
   return boost::report_errors();
 }
-
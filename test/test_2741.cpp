@@ -14,6 +14,7 @@
 #include <boost/utility.hpp>
 
 #include <iostream>
+#include <vector>
 #include <boost/test/unit_test.hpp>
 
 #define DEFAULT_EXECUTION_MONITOR_TYPE execution_monitor::use_sleep_only
@@ -75,6 +76,42 @@ void test_creation_with_attrs()
   timed_test(&do_test_creation_with_attrs, 1);
 }
 
+unsigned numa_node = 0;
+void numa_node_thread()
+{
+  numa_node = boost::this_thread::get_numa_node();
+}
+
+void do_test_creation_with_affinity()
+{
+  std::vector<unsigned> cpus = boost::thread::numa_node_cpus(0);
+  BOOST_CHECK(boost::thread::numa_node_count() >= 1);
+  BOOST_CHECK(! cpus.empty());
+  BOOST_CHECK(boost::thread::numa_node_cpus(boost::thread::numa_node_count()).empty());
+
+  test_value = 0;
+  boost::thread_attributes attrs;
+  attrs.set_affinity(std::vector<unsigned>(1, cpus.front()));
+  boost::thread thrd(attrs, &simple_thread);
+  thrd.join();
+  BOOST_CHECK_EQUAL(test_value, 999);
+
+  numa_node = boost::thread::numa_node_count();
+  boost::thread_attributes node_attrs;
+  if (node_attrs.set_numa_node(0))
+  {
+    boost::thread node_thrd(node_attrs, &numa_node_thread);
+    node_thrd.join();
+    BOOST_CHECK_EQUAL(numa_node, 0u);
+  }
+  BOOST_CHECK(attrs.set_affinity(std::vector<unsigned>()));
+}
+
+void test_creation_with_affinity()
+{
+  timed_test(&do_test_creation_with_affinity, 1);
+}
+
 boost::unit_test_framework::test_suite* init_unit_test_suite(int, char*[])
 {
   boost::unit_test_framework::test_suite* test = BOOST_TEST_SUITE("Boost.Threads: thread attributes test suite");
@@ -82,6 +119,7 @@ boost::unit_test_framework::test_suite* init_unit_test_suite(int, char*[])
   test->add(BOOST_TEST_CASE(test_native_handle));
   test->add(BOOST_TEST_CASE(test_stack_size));
   test->add(BOOST_TEST_CASE(test_creation_with_attrs));
+  test->add(BOOST_TEST_CASE(test_creation_with_affinity));
 
   return test;
 }
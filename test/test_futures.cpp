@@ -1127,6 +1127,28 @@ void test_wait_for_any_from_range()
     }
 }
 
+void test_wait_for_any_from_large_range()
+{
+  LOG;
+    unsigned const count=300;
+    boost::promise<int> promises[count];
+    boost::unique_future<int> futures[count];
+    for(unsigned j=0;j<count;++j)
+    {
+        futures[j]=BOOST_THREAD_MAKE_RV_REF(promises[j].get_future());
+    }
+    boost::thread t(&set_promise_thread, &promises[count-2]);
+
+    boost::unique_future<int>* const future=boost::wait_for_any(futures,futures+count);
+
+    BOOST_CHECK(future==(futures+count-2));
+    BOOST_CHECK(futures[count-2].get()==42);
+    t.join();
+
+    promises[7].set_value(7);
+    BOOST_CHECK(boost::wait_for_any(futures,futures+count)==(futures+7));
+}
+
 void test_wait_for_all_from_range()
 {
   LOG;
@@ -1281,6 +1303,7 @@ boost::unit_test::test_suite* init_unit_test_suite(int, char*[])
     test->add(BOOST_TEST_CASE(test_wait_for_either_of_five_futures_5));
     test->add(BOOST_TEST_CASE(test_wait_for_either_invokes_callbacks));
     test->add(BOOST_TEST_CASE(test_wait_for_any_from_range));
+    test->add(BOOST_TEST_CASE(test_wait_for_any_from_large_range));
     test->add(BOOST_TEST_CASE(test_wait_for_all_from_range));
     test->add(BOOST_TEST_CASE(test_wait_for_all_two_futures));
     test->add(BOOST_TEST_CASE(test_wait_for_all_three_futures));